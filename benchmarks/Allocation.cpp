@@ -0,0 +1,64 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/MemoryPool.hpp>
+#include <TGUI/SignalImpl.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+namespace
+{
+    // Creates and destroys a row of 100 widgets, like a list that recycles its rows while scrolling
+    void createAndDestroyRow()
+    {
+        auto row = tgui::Panel::create({"100%", 30});
+        for (unsigned int i = 0; i < 50; ++i)
+        {
+            auto label = tgui::Label::create("Item");
+            label->setPosition({"parent.width / 50 * " + tgui::to_string(i), 5});
+            row->add(label);
+
+            auto button = tgui::Button::create("X");
+            button->setPosition({tgui::bindRight(label), tgui::bindTop(label)});
+            button->connect("Pressed", []{});
+            row->add(button);
+        }
+    }
+}
+
+// Compare the allocations per iteration of these benchmarks to see the effect of the memory pool
+BENCHMARK("Create and destroy 100 widgets (pool disabled)", "[scenario][allocation]")
+{
+    tgui::MemoryPool::setEnabled(false);
+    runner.run(100, createAndDestroyRow);
+    tgui::MemoryPool::setEnabled(true);
+}
+
+BENCHMARK("Create and destroy 100 widgets (pool enabled)", "[scenario][allocation]")
+{
+    runner.run(100, createAndDestroyRow);
+}
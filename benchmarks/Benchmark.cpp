@@ -0,0 +1,332 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Benchmark.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    std::atomic<std::size_t> allocationCount{0};
+    std::atomic<std::size_t> allocatedBytes{0};
+
+    struct RegisteredBenchmark
+    {
+        std::string name;
+        std::string tags;
+        bench::BenchmarkFunction function;
+    };
+
+    std::vector<RegisteredBenchmark>& getRegisteredBenchmarks()
+    {
+        static std::vector<RegisteredBenchmark> benchmarks;
+        return benchmarks;
+    }
+
+    void* allocate(std::size_t size)
+    {
+        ++allocationCount;
+        allocatedBytes += size;
+
+        if (void* ptr = std::malloc(size ? size : 1))
+            return ptr;
+
+        throw std::bad_alloc{};
+    }
+
+    std::string escapeJson(const std::string& str)
+    {
+        std::string result;
+        for (const char c : str)
+        {
+            if ((c == '"') || (c == '\\'))
+                result += '\\';
+
+            result += c;
+        }
+        return result;
+    }
+
+    std::string escapeCsv(const std::string& str)
+    {
+        std::string result = "\"";
+        for (const char c : str)
+        {
+            if (c == '"')
+                result += '"';
+
+            result += c;
+        }
+        return result + "\"";
+    }
+
+    bool matchesFilter(const RegisteredBenchmark& benchmark, const std::string& filter)
+    {
+        if (filter.empty())
+            return true;
+
+        // Tags have to match completely, other filters can be part of the name
+        if (filter[0] == '[')
+            return benchmark.tags.find(filter) != std::string::npos;
+        else
+            return benchmark.name.find(filter) != std::string::npos;
+    }
+
+    void printUsage(const char* program)
+    {
+        std::cerr << "Usage: " << program << " [options] [filter]\n"
+                  << "  filter                   Only run benchmarks with this text in their name, or with this tag (e.g. [micro])\n"
+                  << "  --format=json|csv        Format of the results (default: json)\n"
+                  << "  --output=<file>          Write the results to a file instead of to the standard output\n"
+                  << "  --repetitions=<count>    Amount of times each benchmark is repeated (default: 5)\n"
+                  << "  --scale=<factor>         Multiplier for the amount of iterations of each benchmark (default: 1)\n"
+                  << "  --list                   Only print the names of the benchmarks\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Count all allocations in the process, including the ones made inside TGUI and SFML
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t getAllocationCount()
+    {
+        return allocationCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t getAllocatedBytes()
+    {
+        return allocatedBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Runner::Runner(std::size_t repetitions, double iterationScale) :
+        m_repetitions   {repetitions},
+        m_iterationScale{iterationScale}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Result* Runner::getResult() const
+    {
+        if (m_finished)
+            return &m_result;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Runner::storeResult(std::size_t iterations, std::vector<double> nsPerIteration, std::size_t allocations, std::size_t bytes)
+    {
+        std::sort(nsPerIteration.begin(), nsPerIteration.end());
+
+        m_result.iterations = iterations;
+        m_result.repetitions = nsPerIteration.size();
+        m_result.minNsPerIteration = nsPerIteration.front();
+        m_result.medianNsPerIteration = nsPerIteration[nsPerIteration.size() / 2];
+        m_result.maxNsPerIteration = nsPerIteration.back();
+        m_result.allocationsPerIteration = static_cast<double>(allocations) / (iterations * nsPerIteration.size());
+        m_result.bytesPerIteration = static_cast<double>(bytes) / (iterations * nsPerIteration.size());
+        m_finished = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Registrar::Registrar(const char* name, const char* tags, BenchmarkFunction function)
+    {
+        getRegisteredBenchmarks().push_back({name, tags, function});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int runBenchmarks(int argc, char* argv[])
+    {
+        std::string format = "json";
+        std::string outputFile;
+        std::string filter;
+        std::size_t repetitions = 5;
+        double scale = 1;
+        bool listOnly = false;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if (arg.compare(0, 9, "--format=") == 0)
+                format = arg.substr(9);
+            else if (arg.compare(0, 9, "--output=") == 0)
+                outputFile = arg.substr(9);
+            else if (arg.compare(0, 14, "--repetitions=") == 0)
+                repetitions = static_cast<std::size_t>(std::max(1, std::atoi(arg.c_str() + 14)));
+            else if (arg.compare(0, 8, "--scale=") == 0)
+                scale = std::atof(arg.c_str() + 8);
+            else if (arg == "--list")
+                listOnly = true;
+            else if ((arg.compare(0, 2, "--") == 0) || !filter.empty())
+            {
+                printUsage(argv[0]);
+                return 1;
+            }
+            else
+                filter = arg;
+        }
+
+        if (((format != "json") && (format != "csv")) || (scale <= 0))
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+
+        std::vector<RegisteredBenchmark> benchmarks = getRegisteredBenchmarks();
+        std::sort(benchmarks.begin(), benchmarks.end(), [](const RegisteredBenchmark& left, const RegisteredBenchmark& right){ return left.name < right.name; });
+
+        std::vector<Result> results;
+        for (const auto& benchmark : benchmarks)
+        {
+            if (!matchesFilter(benchmark, filter))
+                continue;
+
+            if (listOnly)
+            {
+                std::cout << benchmark.name << " " << benchmark.tags << "\n";
+                continue;
+            }
+
+            // Progress is written to stderr so that stdout only contains the results
+            std::cerr << benchmark.name << "..." << std::endl;
+
+            Runner runner{repetitions, scale};
+            benchmark.function(runner);
+            // Benchmarks can skip themselves when something they depend on isn't available (e.g. an OpenGL context)
+            if (!runner.getResult())
+            {
+                std::cerr << "Benchmark '" << benchmark.name << "' was skipped" << std::endl;
+                continue;
+            }
+
+            results.push_back(*runner.getResult());
+            results.back().name = benchmark.name;
+            results.back().tags = benchmark.tags;
+        }
+
+        if (listOnly)
+            return 0;
+
+        std::stringstream stream;
+        if (format == "json")
+        {
+            stream << "[\n";
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                const Result& result = results[i];
+                stream << "  {\"name\": \"" << escapeJson(result.name) << "\""
+                       << ", \"tags\": \"" << escapeJson(result.tags) << "\""
+                       << ", \"iterations\": " << result.iterations
+                       << ", \"repetitions\": " << result.repetitions
+                       << ", \"min_ns\": " << result.minNsPerIteration
+                       << ", \"median_ns\": " << result.medianNsPerIteration
+                       << ", \"max_ns\": " << result.maxNsPerIteration
+                       << ", \"allocations\": " << result.allocationsPerIteration
+                       << ", \"allocated_bytes\": " << result.bytesPerIteration
+                       << "}" << ((i + 1 < results.size()) ? ",\n" : "\n");
+            }
+            stream << "]\n";
+        }
+        else // csv
+        {
+            stream << "name,tags,iterations,repetitions,min_ns,median_ns,max_ns,allocations,allocated_bytes\n";
+            for (const auto& result : results)
+            {
+                stream << escapeCsv(result.name) << "," << escapeCsv(result.tags)
+                       << "," << result.iterations << "," << result.repetitions
+                       << "," << result.minNsPerIteration << "," << result.medianNsPerIteration << "," << result.maxNsPerIteration
+                       << "," << result.allocationsPerIteration << "," << result.bytesPerIteration << "\n";
+            }
+        }
+
+        if (outputFile.empty())
+            std::cout << stream.str();
+        else
+        {
+            std::ofstream file{outputFile};
+            if (!file)
+            {
+                std::cerr << "Failed to open '" << outputFile << "' for writing" << std::endl;
+                return 1;
+            }
+
+            file << stream.str();
+        }
+
+        return 0;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
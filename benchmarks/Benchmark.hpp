@@ -0,0 +1,141 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BENCHMARK_HPP
+#define TGUI_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Amount of calls to the global operator new and amount of bytes requested since the program started
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::size_t getAllocationCount();
+    std::size_t getAllocatedBytes();
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Measurements of a single benchmark
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct Result
+    {
+        std::string name;
+        std::string tags;
+        std::size_t iterations = 0;
+        std::size_t repetitions = 0;
+        double minNsPerIteration = 0;
+        double medianNsPerIteration = 0;
+        double maxNsPerIteration = 0;
+        double allocationsPerIteration = 0;
+        double bytesPerIteration = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Object passed to each benchmark, which measures the code that is passed to its run function
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class Runner
+    {
+    public:
+
+        Runner(std::size_t repetitions, double iterationScale);
+
+        // Calls the function the given amount of times (multiplied with the scale passed on the command line), once for each
+        // repetition. Only the time spent inside this function is measured, so setup code can be placed before calling it.
+        // The function may only be called once per benchmark.
+        template <typename Function>
+        void run(std::size_t iterations, Function&& function)
+        {
+            iterations = std::max<std::size_t>(1, static_cast<std::size_t>(iterations * m_iterationScale));
+
+            std::vector<double> nsPerIteration;
+            std::size_t allocations = 0;
+            std::size_t bytes = 0;
+            for (std::size_t repetition = 0; repetition < m_repetitions; ++repetition)
+            {
+                const std::size_t allocationsBefore = getAllocationCount();
+                const std::size_t bytesBefore = getAllocatedBytes();
+                const auto start = std::chrono::steady_clock::now();
+
+                for (std::size_t i = 0; i < iterations; ++i)
+                    function();
+
+                const auto end = std::chrono::steady_clock::now();
+                allocations += getAllocationCount() - allocationsBefore;
+                bytes += getAllocatedBytes() - bytesBefore;
+
+                nsPerIteration.push_back(std::chrono::duration<double, std::nano>(end - start).count() / iterations);
+            }
+
+            storeResult(iterations, std::move(nsPerIteration), allocations, bytes);
+        }
+
+        // Returns the measurements, or nullptr when run wasn't called by the benchmark
+        const Result* getResult() const;
+
+    private:
+
+        void storeResult(std::size_t iterations, std::vector<double> nsPerIteration, std::size_t allocations, std::size_t bytes);
+
+    private:
+
+        std::size_t m_repetitions;
+        double m_iterationScale;
+        bool m_finished = false;
+        Result m_result;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Adds a benchmark to the list of benchmarks that are executed, this is used by the BENCHMARK macro
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    using BenchmarkFunction = void(*)(Runner&);
+
+    struct Registrar
+    {
+        Registrar(const char* name, const char* tags, BenchmarkFunction function);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Parses the command line, runs the selected benchmarks and prints the results
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    int runBenchmarks(int argc, char* argv[]);
+}
+
+#define TGUI_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define TGUI_BENCHMARK_CONCAT(a, b) TGUI_BENCHMARK_CONCAT_IMPL(a, b)
+
+// Defines a benchmark, the tags are written in the same way as the ones from the tests (e.g. "[micro]" or "[scenario]")
+#define BENCHMARK(name, tags) \
+    static void TGUI_BENCHMARK_CONCAT(benchmarkFunction, __LINE__)(bench::Runner& runner); \
+    static const bench::Registrar TGUI_BENCHMARK_CONCAT(benchmarkRegistrar, __LINE__){name, tags, &TGUI_BENCHMARK_CONCAT(benchmarkFunction, __LINE__)}; \
+    static void TGUI_BENCHMARK_CONCAT(benchmarkFunction, __LINE__)(bench::Runner& runner)
+
+#endif // TGUI_BENCHMARK_HPP
@@ -0,0 +1,96 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+
+namespace
+{
+    // Creates a row panel with 100 widgets, like the template of a row in a list that is instantiated many times
+    tgui::Panel::Ptr createRowTemplate(tgui::Theme& theme)
+    {
+        auto row = tgui::Panel::create({2000, 30});
+        for (unsigned int i = 0; i < 25; ++i)
+        {
+            auto picture = tgui::Picture::create("resources/Black.png");
+            picture->setSize(20, 20);
+            picture->setPosition(i * 80.f, 5);
+            row->add(picture);
+
+            auto label = tgui::Label::create("Column " + tgui::to_string(i));
+            label->setRenderer(theme.getRenderer("Label"));
+            label->setPosition(i * 80.f + 20, 5);
+            row->add(label);
+
+            auto editBox = tgui::EditBox::create();
+            editBox->setRenderer(theme.getRenderer("EditBox"));
+            editBox->setDefaultText("Value");
+            editBox->setPosition(i * 80.f + 20, 5);
+            editBox->setSize(40, 20);
+            row->add(editBox);
+
+            auto button = tgui::Button::create("...");
+            button->setRenderer(theme.getRenderer("Button"));
+            button->setPosition(i * 80.f + 60, 5);
+            button->setSize(20, 20);
+            row->add(button);
+        }
+
+        return row;
+    }
+}
+
+BENCHMARK("Panel::copy panel with 100 widgets", "[scenario][clone]")
+{
+    tgui::Theme theme{"resources/Black.txt"};
+    const auto row = createRowTemplate(theme);
+
+    std::vector<tgui::Panel::Ptr> clones;
+    clones.reserve(200);
+    runner.run(200, [&]{
+            clones.push_back(tgui::Panel::copy(row));
+        });
+}
+
+BENCHMARK("Instantiate row template 100 times", "[scenario][clone]")
+{
+    tgui::Theme theme{"resources/Black.txt"};
+    const auto row = createRowTemplate(theme);
+
+    runner.run(5, [&]{
+            auto list = tgui::Panel::create({2000, 3000});
+            for (unsigned int i = 0; i < 100; ++i)
+            {
+                auto clone = tgui::Panel::copy(row);
+                clone->setPosition(0, i * 30.f);
+                list->add(clone);
+            }
+        });
+}
@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/Widgets/SpinButton.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace
+{
+    // Adds 10 panels with 100 buttons and labels each to the gui
+    void addWidgets(tgui::Gui& gui)
+    {
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            auto panel = tgui::Panel::create({200, 300});
+            panel->setPosition((i % 5) * 200.f, (i / 5) * 300.f);
+            gui.add(panel);
+
+            for (unsigned int j = 0; j < 50; ++j)
+            {
+                auto button = tgui::Button::create("Button");
+                button->setPosition((j % 2) * 100.f, (j / 2) * 12.f);
+                button->setSize(50, 12);
+                panel->add(button);
+
+                auto label = tgui::Label::create("Label");
+                label->setPosition((j % 2) * 100.f + 50, (j / 2) * 12.f);
+                label->setTextSize(10);
+                panel->add(label);
+            }
+        }
+    }
+}
+
+BENCHMARK("Gui::draw (1000 widgets)", "[scenario][drawing]")
+{
+    // Drawing requires an OpenGL context, the benchmark is skipped when the render texture can't be created
+    sf::RenderTexture target;
+    if (!target.create(1000, 600))
+        return;
+
+    tgui::Gui gui{target};
+    addWidgets(gui);
+
+    runner.run(100, [&]{
+            target.clear();
+            gui.draw();
+            target.display();
+        });
+}
+
+BENCHMARK("Gui::draw (1000 widgets in cached panels)", "[scenario][drawing]")
+{
+    sf::RenderTexture target;
+    if (!target.create(1000, 600))
+        return;
+
+    tgui::Gui gui{target};
+    addWidgets(gui);
+    for (auto& widget : gui.getWidgets())
+        widget->setCachedAsBitmap(true);
+
+    runner.run(100, [&]{
+            target.clear();
+            gui.draw();
+            target.display();
+        });
+}
+
+BENCHMARK("Gui::draw (300 radio buttons, knobs and spin buttons)", "[scenario][drawing]")
+{
+    sf::RenderTexture target;
+    if (!target.create(1000, 600))
+        return;
+
+    tgui::Gui gui{target};
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        const float x = (i % 10) * 100.f;
+        const float y = (i / 10) * 60.f;
+
+        auto radioButton = tgui::RadioButton::create();
+        radioButton->setPosition(x, y);
+        radioButton->setChecked(i % 2 == 0);
+        gui.add(radioButton);
+
+        auto knob = tgui::Knob::create();
+        knob->setPosition(x + 30, y);
+        knob->setSize(40, 40);
+        knob->setValue(static_cast<int>(i * 3));
+        gui.add(knob);
+
+        auto spinButton = tgui::SpinButton::create();
+        spinButton->setPosition(x + 75, y);
+        spinButton->setSize(20, 40);
+        gui.add(spinButton);
+    }
+
+    runner.run(100, [&]{
+            target.clear();
+            gui.draw();
+            target.display();
+        });
+}
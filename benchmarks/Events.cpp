@@ -0,0 +1,150 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace
+{
+    // Fills a panel of 1000x1000 pixels with a grid of 100x100 buttons
+    tgui::Panel::Ptr createButtonGrid()
+    {
+        auto panel = tgui::Panel::create({1000, 1000});
+        for (unsigned int y = 0; y < 100; ++y)
+        {
+            for (unsigned int x = 0; x < 100; ++x)
+            {
+                auto button = tgui::Button::create("B");
+                button->setPosition(x * 10.f, y * 10.f);
+                button->setSize(10, 10);
+                panel->add(button);
+            }
+        }
+
+        return panel;
+    }
+
+    sf::Event createMouseEvent(sf::Event::EventType type, int x, int y)
+    {
+        sf::Event event;
+        event.type = type;
+        if (type == sf::Event::MouseMoved)
+        {
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+        }
+        else
+        {
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = x;
+            event.mouseButton.y = y;
+        }
+
+        return event;
+    }
+}
+
+BENCHMARK("Container::handleEvent mouse move storm (10k widgets)", "[scenario][events]")
+{
+    auto panel = createButtonGrid();
+
+    // The mouse moves diagonally over the grid so that it enters and leaves a button on almost every event
+    unsigned int step = 0;
+    runner.run(5000, [&]{
+            sf::Event event = createMouseEvent(sf::Event::MouseMoved, (step * 7) % 1000, (step * 13) % 1000);
+            panel->handleEvent(event);
+            ++step;
+        });
+}
+
+BENCHMARK("Gui::handleEvent 32 mouse moves per frame, queued (10k widgets)", "[scenario][events]")
+{
+    // The gui needs a render target to map the mouse coordinates, the benchmark is skipped when it can't be created
+    sf::RenderTexture target;
+    if (!target.create(1000, 1000))
+        return;
+
+    tgui::Gui gui{target};
+    gui.add(createButtonGrid());
+    gui.setEventQueueEnabled(true);
+
+    // Simulates a mouse with a high polling rate, which sends many moves between two frames
+    unsigned int step = 0;
+    runner.run(500, [&]{
+            for (unsigned int i = 0; i < 32; ++i)
+            {
+                gui.handleEvent(createMouseEvent(sf::Event::MouseMoved, (step * 7) % 1000, (step * 13) % 1000));
+                ++step;
+            }
+
+            gui.handleQueuedEvents();
+        });
+}
+
+BENCHMARK("Container::handleEvent click storm (10k widgets)", "[scenario][events]")
+{
+    auto panel = createButtonGrid();
+
+    unsigned int step = 0;
+    runner.run(2000, [&]{
+            const int x = (step * 7) % 1000;
+            const int y = (step * 13) % 1000;
+
+            sf::Event event = createMouseEvent(sf::Event::MouseButtonPressed, x, y);
+            panel->handleEvent(event);
+
+            event = createMouseEvent(sf::Event::MouseButtonReleased, x, y);
+            panel->handleEvent(event);
+            ++step;
+        });
+}
+
+BENCHMARK("Container::handleEvent text entered in validated EditBox", "[micro][events]")
+{
+    auto panel = tgui::Panel::create();
+    auto editBox = tgui::EditBox::create();
+    editBox->setSize(400, 30);
+    editBox->setInputValidator(tgui::EditBox::Validator::Float);
+    panel->add(editBox);
+    editBox->setFocused(true);
+
+    sf::Event event;
+    event.type = sf::Event::TextEntered;
+
+    unsigned int step = 0;
+    runner.run(20000, [&]{
+            // Start again with an empty text from time to time so that the benchmark doesn't only measure very long texts
+            if (step % 200 == 0)
+                editBox->setText("");
+
+            event.text.unicode = '0' + (step % 10);
+            panel->handleEvent(event);
+            ++step;
+        });
+}
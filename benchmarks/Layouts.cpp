@@ -0,0 +1,86 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+BENCHMARK("Layout recalculation chain (1000 widgets)", "[scenario][layouts]")
+{
+    // Every widget is placed to the right of the previous one and has the same size, so resizing the first widget
+    // causes the layouts of all other widgets to be recalculated.
+    auto panel = tgui::Panel::create();
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        auto widget = tgui::ClickableWidget::create();
+        if (widgets.empty())
+            widget->setSize(10, 10);
+        else
+        {
+            widget->setPosition(tgui::bindRight(widgets.back()), tgui::bindTop(widgets.back()));
+            widget->setSize(tgui::bindSize(widgets.back()));
+        }
+
+        panel->add(widget);
+        widgets.push_back(widget);
+    }
+
+    unsigned int step = 0;
+    runner.run(200, [&]{
+            widgets.front()->setSize(10.f + (step % 2), 10.f + (step % 2));
+            ++step;
+        });
+}
+
+BENCHMARK("Layout string parsing", "[micro][layouts]")
+{
+    auto panel = tgui::Panel::create({800, 600});
+    auto widget = tgui::ClickableWidget::create();
+    panel->add(widget, "Widget");
+
+    runner.run(10000, [&]{
+            widget->setPosition("(parent.width - width) / 2", "10%");
+            widget->setSize("parent.width / 3 + 10", "parent.height - 2 * 20");
+        });
+}
+
+BENCHMARK("Relative layouts updated by parent resize (1000 widgets)", "[scenario][layouts]")
+{
+    auto panel = tgui::Panel::create({800, 600});
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        auto widget = tgui::ClickableWidget::create();
+        widget->setPosition("10%", "5%");
+        widget->setSize("80%", "parent.height / 10");
+        panel->add(widget);
+    }
+
+    unsigned int step = 0;
+    runner.run(500, [&]{
+            panel->setSize(800.f + (step % 100), 600.f + (step % 100));
+            ++step;
+        });
+}
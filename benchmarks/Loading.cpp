@@ -0,0 +1,143 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/FormLoader.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <fstream>
+
+namespace
+{
+    // Creates the contents of a widget file with 1000 widgets, divided over 100 panels
+    std::string createLargeForm()
+    {
+        auto root = tgui::Panel::create();
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto panel = tgui::Panel::create({200, 300});
+            panel->setPosition({(i % 10) * 200.f, (i / 10) * 300.f});
+            root->add(panel, "Panel" + tgui::to_string(i));
+
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                auto label = tgui::Label::create("Label " + tgui::to_string(j));
+                label->setPosition(10, 10 + j * 90.f);
+                panel->add(label, "Label" + tgui::to_string(j));
+
+                auto editBox = tgui::EditBox::create();
+                editBox->setPosition(10, 40 + j * 90.f);
+                editBox->setSize("parent.width - 20", 25);
+                editBox->setDefaultText("Value");
+                panel->add(editBox, "EditBox" + tgui::to_string(j));
+
+                auto button = tgui::Button::create("Apply");
+                button->setPosition("parent.width - width - 10", 70 + j * 90.f);
+                panel->add(button, "Button" + tgui::to_string(j));
+            }
+        }
+
+        std::stringstream stream;
+        root->saveWidgetsToStream(stream);
+        return stream.str();
+    }
+
+    // Writes 8 copies of the large form to files, like an application that has several forms to load at startup
+    std::vector<std::string> createFormFiles()
+    {
+        const std::string form = createLargeForm();
+
+        std::vector<std::string> filenames;
+        for (unsigned int i = 0; i < 8; ++i)
+        {
+            filenames.push_back("BenchmarkForm" + tgui::to_string(i) + ".txt");
+            std::ofstream{filenames.back()} << form;
+        }
+
+        return filenames;
+    }
+}
+
+BENCHMARK("DataIO::parse large form (1000 widgets)", "[scenario][loading]")
+{
+    const std::string form = createLargeForm();
+
+    runner.run(5, [&]{
+            std::stringstream stream{form};
+            tgui::DataIO::parse(stream);
+        });
+}
+
+BENCHMARK("Container::loadWidgetsFromStream large form (1000 widgets)", "[scenario][loading]")
+{
+    const std::string form = createLargeForm();
+    auto panel = tgui::Panel::create();
+
+    runner.run(3, [&]{
+            panel->loadWidgetsFromStream(std::stringstream{form});
+        });
+}
+
+BENCHMARK("Container::loadWidgetsFromFile 8 large forms", "[scenario][loading]")
+{
+    const auto filenames = createFormFiles();
+    auto panel = tgui::Panel::create();
+
+    runner.run(1, [&]{
+            for (const auto& filename : filenames)
+                panel->loadWidgetsFromFile(filename);
+        });
+}
+
+BENCHMARK("FormLoader 8 large forms", "[scenario][loading]")
+{
+    const auto filenames = createFormFiles();
+    auto panel = tgui::Panel::create();
+    tgui::FormLoader loader;
+
+    runner.run(1, [&]{
+            for (const auto& filename : filenames)
+                loader.loadFileAsync(filename);
+
+            for (const auto& filename : filenames)
+                loader.loadWidgets(*panel, filename);
+        });
+}
+
+BENCHMARK("Theme loading", "[micro][loading]")
+{
+    runner.run(100, [&]{
+            tgui::DefaultThemeLoader::flushCache();
+            tgui::Theme theme{"resources/Black.txt"};
+            theme.getRenderer("Button");
+            theme.getRenderer("EditBox");
+            theme.getRenderer("ChildWindow");
+        });
+}
@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Text.hpp>
+#include <TGUI/Widgets/ChatBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <cstdlib>
+
+namespace
+{
+    const sf::String paragraph = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et "
+                                 "dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip "
+                                 "ex ea commodo consequat. Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu "
+                                 "fugiat nulla pariatur.\n";
+
+    sf::String createLongText(std::size_t paragraphs)
+    {
+        sf::String text;
+        for (std::size_t i = 0; i < paragraphs; ++i)
+            text += paragraph;
+
+        return text;
+    }
+}
+
+BENCHMARK("Text::wordWrap long string (40k characters)", "[micro][text]")
+{
+    const sf::String text = createLongText(100);
+    const tgui::Font font = tgui::getGlobalFont();
+
+    std::size_t totalLength = 0;
+    runner.run(20, [&]{
+            totalLength += tgui::Text::wordWrap(300, text, font, 16, false).getSize();
+        });
+
+    // Use the result so that the compiler can't remove the calls
+    if (totalLength == 0)
+        std::abort();
+}
+
+BENCHMARK("Text::wordWrap short string", "[micro][text]")
+{
+    const tgui::Font font = tgui::getGlobalFont();
+
+    std::size_t totalLength = 0;
+    runner.run(20000, [&]{
+            totalLength += tgui::Text::wordWrap(150, "Short text that needs to be wrapped", font, 16, false).getSize();
+        });
+
+    if (totalLength == 0)
+        std::abort();
+}
+
+BENCHMARK("Label::setText (10k updates)", "[scenario][text]")
+{
+    auto label = tgui::Label::create();
+    label->setSize(200, 100);
+
+    const sf::String texts[] = {"Score: 1250", "Score: 1260\nLives: 3", "A somewhat longer text that needs to be wrapped over multiple lines"};
+
+    unsigned int step = 0;
+    runner.run(10000, [&]{
+            label->setText(texts[step % 3]);
+            ++step;
+        });
+}
+
+BENCHMARK("ChatBox::addLine at volume (10k lines)", "[scenario][text]")
+{
+    runner.run(1, [&]{
+            auto chatBox = tgui::ChatBox::create();
+            chatBox->setSize(400, 300);
+            for (unsigned int i = 0; i < 10000; ++i)
+                chatBox->addLine("Player " + tgui::to_string(i % 8) + ": " + paragraph.substring(0, 20 + (i * 37) % 200));
+        });
+}
+
+BENCHMARK("ChatBox::addLine with line limit (10k lines, limit 100)", "[scenario][text]")
+{
+    runner.run(1, [&]{
+            auto chatBox = tgui::ChatBox::create();
+            chatBox->setSize(400, 300);
+            chatBox->setLineLimit(100);
+            for (unsigned int i = 0; i < 10000; ++i)
+                chatBox->addLine("Player " + tgui::to_string(i % 8) + ": " + paragraph.substring(0, 20 + (i * 37) % 200));
+        });
+}
+
+BENCHMARK("TextBox typing in large document (40k characters)", "[scenario][text]")
+{
+    auto textBox = tgui::TextBox::create();
+    textBox->setSize(400, 300);
+    textBox->setText(createLongText(100));
+    textBox->setCaretPosition(20000);
+
+    runner.run(1000, [&]{
+            textBox->textEntered('x');
+        });
+}
+
+BENCHMARK("TextBox::addText to large document (40k characters)", "[scenario][text]")
+{
+    auto textBox = tgui::TextBox::create();
+    textBox->setSize(400, 300);
+    textBox->setText(createLongText(100));
+
+    runner.run(1000, [&]{
+            textBox->addText("Log line\n");
+        });
+}
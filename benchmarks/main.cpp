@@ -0,0 +1,11 @@
+#include "Benchmark.hpp"
+#include <TGUI/Gui.hpp>
+
+int main(int argc, char* argv[])
+{
+    // All benchmarks are performed while a Gui object exists.
+    // This will keep the global font alive instead of being destructed and reconstructed multiple times between the benchmarks.
+    tgui::Gui gui;
+
+    return bench::runBenchmarks(argc, argv);
+}
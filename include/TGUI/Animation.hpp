@@ -27,15 +27,19 @@
 #define TGUI_ANIMATION_HPP
 
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/Color.hpp>
 #include <SFML/System/Time.hpp>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     class Widget;
+    class Container;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Type of animation to show/hide widget
@@ -55,6 +59,31 @@ namespace tgui
         SlideFromBottom = SlideToTop  ///< Slide from bottom to show or to the top to hide
     };
 
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that determines how fast an animation progresses over its duration
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class EasingType
+    {
+        Linear,     ///< Constant speed
+        EaseIn,     ///< Starts slow and speeds up (cubic)
+        EaseOut,    ///< Starts fast and slows down (cubic)
+        EaseInOut,  ///< Starts slow, speeds up and slows down again at the end (cubic)
+        EaseOutBack ///< Slows down while slightly overshooting the end value before settling on it
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Applies an easing curve to the progress of an animation
+    ///
+    /// @param easing    Curve to apply
+    /// @param progress  Linear progress of the animation, between 0 and 1
+    ///
+    /// @return Eased progress, which is 0 when progress is 0 and 1 when progress is 1 (but may lie outside that range in between)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API float applyEasing(EasingType easing, float progress);
+
+
     namespace priv
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -67,7 +96,8 @@ namespace tgui
                 None = 0,
                 Move = 1,
                 Resize = 2,
-                Fade = 4
+                Fade = 4,
+                Color = 8
             };
 
             // Move constructor has to be explicitly declared since this class has a destructor
@@ -83,8 +113,14 @@ namespace tgui
             virtual bool update(sf::Time elapsedTime) = 0;
             virtual void finish();
 
+            // Returns whether this animation changes the same property as the other one, in which case it replaces it
+            virtual bool changesSameProperty(const Animation& other) const;
+
         protected:
-            Animation(Type type, std::shared_ptr<Widget> widget, sf::Time duration, std::function<void()> finishedCallback);
+            Animation(Type type, std::shared_ptr<Widget> widget, sf::Time duration, std::function<void()> finishedCallback, EasingType easing = EasingType::Linear);
+
+            // Returns the progress of the animation, with the easing curve applied to it
+            float getProgress() const;
 
         protected:
             Type m_type = Type::None;
@@ -94,6 +130,7 @@ namespace tgui
             sf::Time m_elapsedTime;
 
             std::function<void()> m_finishedCallback;
+            EasingType m_easing = EasingType::Linear;
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,7 +138,7 @@ namespace tgui
         class TGUI_API MoveAnimation : public Animation
         {
         public:
-            MoveAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
+            MoveAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr, EasingType easing = EasingType::Linear);
 
             bool update(sf::Time elapsedTime) override;
 
@@ -117,7 +154,7 @@ namespace tgui
         class TGUI_API ResizeAnimation : public Animation
         {
         public:
-            ResizeAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
+            ResizeAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr, EasingType easing = EasingType::Linear);
 
             bool update(sf::Time elapsedTime) override;
 
@@ -133,7 +170,7 @@ namespace tgui
         class TGUI_API FadeAnimation : public Animation
         {
         public:
-            FadeAnimation(std::shared_ptr<Widget> widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
+            FadeAnimation(std::shared_ptr<Widget> widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback = nullptr, EasingType easing = EasingType::Linear);
 
             bool update(sf::Time elapsedTime) override;
 
@@ -146,6 +183,65 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Changes a color property in the renderer of the widget
+        class TGUI_API ColorAnimation : public Animation
+        {
+        public:
+            ColorAnimation(std::shared_ptr<Widget> widget, std::string property, Color start, Color end, sf::Time duration, std::function<void()> finishedCallback = nullptr, EasingType easing = EasingType::Linear);
+
+            bool update(sf::Time elapsedTime) override;
+
+            void finish() override;
+
+            bool changesSameProperty(const Animation& other) const override;
+
+        private:
+            std::string m_property;
+            Color m_startColor;
+            Color m_endColor;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Advances the animations of the widgets inside a gui and calls the update function of the widgets that need it (e.g.
+        // for a blinking caret), so that only those widgets are visited each frame. Widgets that aren't part of a gui advance
+        // their animations in Widget::update instead.
+        class TGUI_API AnimationScheduler
+        {
+        public:
+            AnimationScheduler(const Container* root);
+            AnimationScheduler(const AnimationScheduler&) = delete;
+            AnimationScheduler& operator=(const AnimationScheduler&) = delete;
+            ~AnimationScheduler();
+
+            // Starts advancing the animations of the widget, until it has none left
+            void add(const std::shared_ptr<Widget>& widget);
+
+            // Stops advancing the animations of the widget, e.g. because it was removed from the gui
+            void remove(Widget* widget);
+
+            // Calls the update function of the widget every frame, until the widget no longer needs it or leaves the gui
+            void addUpdatedWidget(const std::shared_ptr<Widget>& widget);
+
+            // Advances the animations and updates the widgets that need it. Hidden widgets (and widgets inside a hidden
+            // container) are paused, just like they were when every widget was updated by its parent.
+            void update(sf::Time elapsedTime);
+
+            // Returns whether there are visible widgets with animations that haven't finished yet
+            bool isAnimating() const;
+
+        private:
+
+            // Calls the update function of the widgets in m_updatedWidgets
+            void updateWidgets(sf::Time elapsedTime);
+
+            const Container* m_root;
+            std::vector<std::shared_ptr<Widget>> m_widgets;
+            std::vector<std::shared_ptr<Widget>> m_updatedWidgets;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     } // namespace priv
 } // namespace tgui
 
@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_CIRCLE_SHAPE_HPP
+#define TGUI_CIRCLE_SHAPE_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Circle that keeps its vertices between draw calls
+    ///
+    /// Unlike sf::CircleShape, which is typically created again every time a widget is drawn, the points of the circle and
+    /// its outline are only calculated when the radius, point count or outline thickness changes. Changing the colors only
+    /// updates the colors of the existing vertices and setting a property to its current value does nothing, so widgets can
+    /// call the setters on every draw.
+    ///
+    /// The circle is drawn with its top-left corner at the origin, the position is set by transforming the render states.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CircleShape
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param radius      Radius of the circle
+        /// @param pointCount  Amount of points that approximate the circle
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CircleShape(float radius = 0, std::size_t pointCount = 30);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the radius of the circle
+        ///
+        /// @param radius  New radius
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRadius(float radius);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the radius of the circle
+        ///
+        /// @return Radius of the circle
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getRadius() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of points that approximate the circle
+        ///
+        /// @param pointCount  New amount of points, which must be at least 3
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPointCount(std::size_t pointCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of points that approximate the circle
+        ///
+        /// @return Amount of points
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getPointCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color of the inside of the circle
+        ///
+        /// @param color  New fill color, nothing is drawn for the inside when it is fully transparent
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFillColor(const sf::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color of the inside of the circle
+        ///
+        /// @return Fill color
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getFillColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color of the outline
+        ///
+        /// @param color  New outline color
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOutlineColor(const sf::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color of the outline
+        ///
+        /// @return Outline color
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Color& getOutlineColor() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the thickness of the outline
+        ///
+        /// @param thickness  New thickness. Like with sf::CircleShape, a positive value places the outline outside the circle and
+        ///                   a negative value places it inside the circle.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOutlineThickness(float thickness);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the thickness of the outline
+        ///
+        /// @return Outline thickness
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getOutlineThickness() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the circle
+        ///
+        /// @param target  Render target to draw to
+        /// @param states  Current render states
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Recalculates the positions of all vertices
+        void updateVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        float       m_radius = 0;
+        std::size_t m_pointCount = 30;
+        float       m_outlineThickness = 0;
+        sf::Color   m_fillColor = sf::Color::White;
+        sf::Color   m_outlineColor = sf::Color::White;
+
+        std::vector<sf::Vertex> m_fillVertices;    // Drawn as a triangle fan around the center
+        std::vector<sf::Vertex> m_outlineVertices; // Drawn as a triangle strip, empty when there is no outline
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_CIRCLE_SHAPE_HPP
@@ -68,6 +68,13 @@ namespace tgui
         static void setGuiView(const sf::View& view);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the view that was set with setGuiView
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const sf::View& getGuiView();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -28,6 +28,7 @@
 
 
 #include <list>
+#include <limits>
 
 #include <TGUI/Widget.hpp>
 
@@ -35,6 +36,8 @@
 
 namespace tgui
 {
+    class PopupLayer;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Container widget
     ///
@@ -254,6 +257,16 @@ namespace tgui
         void loadWidgetsFromStream(std::stringstream&& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a widget file that was already parsed
+        ///
+        /// @param rootNode  Root node of the widget file, as returned by DataIO::parse
+        ///
+        /// @see FormLoader
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the child widgets to a text file
         ///
@@ -369,6 +382,13 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Marks the cached bitmaps of this container and of all widgets inside it as outdated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void outdateCachedBitmaps();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -414,6 +434,12 @@ namespace tgui
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the memory of the container and of all its child widgets to the report
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reportMemoryUsage(MemoryUsage& usage) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,6 +467,8 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        friend class Gui; // Gui follows m_focusedWidget to cache the focus path and reads m_widgets to build the tab order
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -496,6 +524,41 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the object that advances the animations of the widgets inside the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        priv::AnimationScheduler& getAnimationScheduler();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Lets the gui know that the widgets will look different after the given time (immediately when the time is zero)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestRedraw(sf::Time delay = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the layer in which widgets like combo boxes and menu bars show their popups
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::shared_ptr<PopupLayer>& getPopupLayer() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns a render texture of at least the given size for a widget that is cached as a bitmap, or nullptr on failure
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<sf::RenderTexture> acquireRenderTexture(sf::Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Takes back a render texture that a widget no longer needs, so that it can be reused while the gui exists
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseRenderTexture(std::unique_ptr<sf::RenderTexture>& texture);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -518,7 +581,19 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        priv::AnimationScheduler m_animationScheduler{this};
+
+        // Has anything changed since the gui was last drawn and how long after the last update will something change by itself
+        bool m_redrawNeeded = true;
+        sf::Time m_timeUntilNextChange = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+        std::shared_ptr<PopupLayer> m_popupLayer;
+
+        // Render textures of widgets that no longer needed them, they are destroyed together with the gui
+        std::vector<std::unique_ptr<sf::RenderTexture>> m_renderTexturePool;
+
         friend class Gui; // Required to let Gui access protected members from container and Widget
+        friend class PopupLayer; // Required to let the popup layer give the focus back
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
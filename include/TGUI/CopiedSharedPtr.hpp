@@ -27,6 +27,7 @@
 #define TGUI_COPIED_SHARED_PTR_HPP
 
 
+#include <TGUI/MemoryPool.hpp>
 #include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,12 +43,12 @@ namespace tgui
 
         template <typename... Args>
         CopiedSharedPtr(Args&&... args) noexcept
-            : m_WidgetPtr{std::make_shared<WidgetType>(std::forward<Args>(args)...)}
+            : m_WidgetPtr{makePooled<WidgetType>(std::forward<Args>(args)...)}
         {
         }
 
         CopiedSharedPtr(const CopiedSharedPtr& other) noexcept
-            : m_WidgetPtr{std::make_shared<WidgetType>(*other.m_WidgetPtr)}
+            : m_WidgetPtr{makePooled<WidgetType>(*other.m_WidgetPtr)}
         {
         }
 
@@ -59,7 +60,7 @@ namespace tgui
         CopiedSharedPtr& operator=(const CopiedSharedPtr& other) noexcept
         {
             if (&other != this)
-                m_WidgetPtr = std::make_shared<WidgetType>(*other.m_WidgetPtr);
+                m_WidgetPtr = makePooled<WidgetType>(*other.m_WidgetPtr);
 
             return *this;
         }
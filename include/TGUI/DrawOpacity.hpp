@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_DRAW_OPACITY_HPP
+#define TGUI_DRAW_OPACITY_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <cstddef>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Opacity that is multiplied with the colors of everything that the library draws. Containers multiply it with their
+        // own opacity while drawing their child widgets, so that the opacity of a container doesn't have to be stored inside
+        // each of its children.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API void setDrawOpacity(float opacity);
+        TGUI_API float getDrawOpacity();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the color multiplied with the draw opacity. Colors that are drawn with a premultiplied alpha blend mode
+        // (e.g. the cached bitmap of a widget) have their color channels faded as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API sf::Color applyDrawOpacity(sf::Color color, const sf::BlendMode& blendMode);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a copy of the vertices with the draw opacity applied to their colors. The copy is stored in a buffer that
+        // is reused by the next call to fadeVertices or fadeShape.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API const sf::Vertex* fadeVertices(const sf::Vertex* vertices, std::size_t vertexCount, const sf::BlendMode& blendMode);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the points of a filled shape without texture as a triangle fan in its faded fill color, in the same buffer
+        // as fadeVertices. The amount of vertices is shape.getPointCount().
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API const sf::Vertex* fadeShape(const sf::Shape& shape, const sf::BlendMode& blendMode);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DRAW_OPACITY_HPP
@@ -28,6 +28,7 @@
 
 #include <TGUI/Config.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
 #include <cstdint>
 #include <string>
 #include <cstddef>
@@ -82,6 +83,8 @@ namespace tgui
         ///
         /// @param font  Font to copy
         ///
+        /// No copy is made when the font was loaded by TGUI itself, see FontManager::getFontCopy.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Font(const sf::Font& font);
 
@@ -90,6 +93,9 @@ namespace tgui
         /// @brief Constructor to create the font from a byte array
         /// @param data         Pointer to the file data in memory
         /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// When the same bytes were already loaded, the existing font is shared instead of loading it again.
+        /// The data is copied, so it doesn't have to remain valid after the constructor returns.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Font(const void* data, std::size_t sizeInBytes);
 
@@ -199,6 +205,40 @@ namespace tgui
         const sf::Glyph& getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the glyphs of some characters ahead of time
+        ///
+        /// Glyphs are normally rendered the first time they are drawn, which also uploads the font texture again each time it
+        /// has to grow. Preloading the characters that are going to be shown (e.g. when loading a theme or creating the gui)
+        /// avoids the delay during the frame that first shows them.
+        ///
+        /// @param characters       Characters to load, characters that were already loaded are skipped by the font
+        /// @param characterSize    Text size at which the characters will be drawn
+        /// @param bold             Load the bold version of the characters instead of the regular one?
+        /// @param outlineThickness Thickness of the outline. When it isn't 0, both the outlines and the filled glyphs are loaded.
+        ///
+        /// This function does nothing when no font was set.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(const sf::String& characters, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the glyphs of a range of characters ahead of time
+        ///
+        /// @param first            First unicode code point of the range (e.g. 0x20 for the printable ASCII characters)
+        /// @param last             Last unicode code point of the range, inclusive (e.g. 0x7E for the printable ASCII characters)
+        /// @param characterSize    Text size at which the characters will be drawn
+        /// @param bold             Load the bold version of the characters instead of the regular one?
+        /// @param outlineThickness Thickness of the outline. When it isn't 0, both the outlines and the filled glyphs are loaded.
+        ///
+        /// Characters that don't exist in the font are loaded as well (they all look the same), so large ranges (e.g. all CJK
+        /// characters) take a lot of time and texture memory. Prefer passing the characters that will actually be used.
+        ///
+        /// @see preloadGlyphs(const sf::String&, unsigned int, bool, float)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(std::uint32_t first, std::uint32_t last, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FONT_MANAGER_HPP
+#define TGUI_FONT_MANAGER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Makes sure that the same font is only loaded once
+    ///
+    /// Every sf::Font has its own glyph cache and textures. When the same font is used by multiple themes, renderers or gui
+    /// objects, they should share a single sf::Font so that each glyph is only rendered once. The Font class and the
+    /// deserializer obtain their fonts from this class, which keeps track of the fonts that are still in use. A font is
+    /// destroyed as soon as no Font object references it anymore, loading it again afterwards creates a new sf::Font.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FontManager
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from a file
+        ///
+        /// @param filename  Filename of the font to load, the resource path is not inserted by this function
+        ///
+        /// The second time you call this function with the same filename, the previously loaded font will be reused.
+        ///
+        /// @return Loaded font. When loading failed, an empty font is returned which is not reused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> getFontFromFile(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from the contents of a font file in memory
+        ///
+        /// @param data         Pointer to the file data in memory
+        /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// The font is reused when the same bytes were loaded before, even if they were stored in a different buffer.
+        /// Unlike sf::Font::loadFromMemory, the data is copied, so the buffer can be freed as soon as this function returns.
+        ///
+        /// @return Loaded font. When loading failed, an empty font is returned which is not reused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> getFontFromMemory(const void* data, std::size_t sizeInBytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a font that is shared with the given font, or a copy of it
+        ///
+        /// @param font  Font to share or copy
+        ///
+        /// When the font was loaded by this class (e.g. the font returned by getGlobalFont()->getFont() was dereferenced), the
+        /// original font is returned. Otherwise a copy of the font has to be made, as it is unknown how long it will exist.
+        ///
+        /// @return Font that looks identical to the given font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> getFontCopy(const sf::Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of loaded fonts that are still in use
+        ///
+        /// @return Amount of sf::Font objects that were loaded by this class and that are still referenced somewhere
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getFontCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Font loaded from memory together with the copy of the data that it reads from
+        struct FontWithData
+        {
+            std::vector<unsigned char> data;
+            sf::Font font;
+        };
+
+        // Font loaded from memory, the data is kept to compare the contents when another buffer has the same hash.
+        // The data belongs to the font, so it may only be accessed while the font is locked.
+        struct MemoryFont
+        {
+            std::weak_ptr<sf::Font> font;
+            const void* data;
+            std::size_t size;
+        };
+
+        // Removes the fonts that are no longer used by anyone
+        static void removeUnusedFonts();
+
+        static std::map<std::string, std::weak_ptr<sf::Font>> m_fileFonts;
+        static std::multimap<std::uint64_t, MemoryFont> m_memoryFonts;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_MANAGER_HPP
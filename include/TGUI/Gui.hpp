@@ -30,6 +30,7 @@
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +44,15 @@ namespace tgui
     {
       public:
 
+        /// Amount of events that passed through the event queue during the last call to handleQueuedEvents
+        struct EventQueueStats
+        {
+            std::size_t received = 0;   ///< Events that were passed to handleEvent
+            std::size_t merged = 0;     ///< Events that were merged into an earlier event and thus never reached the widgets
+            std::size_t dispatched = 0; ///< Events that were passed to the widgets
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         ///
@@ -141,10 +151,58 @@ namespace tgui
         ///
         /// You should call this function in your event loop.
         ///
+        /// When the event queue is enabled, the event is only stored and this function always returns false.
+        ///
+        /// @see setEventQueueEnabled
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(sf::Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether events are queued and passed to the widgets once per frame
+        ///
+        /// @param enabled  Should handleEvent store the events instead of handling them immediately?
+        ///
+        /// When the queue is enabled, handleEvent only stores the events. Mouse moves, touch moves and wheel scrolls that
+        /// follow each other are merged into a single event, so that a mouse with a high polling rate doesn't cause the widgets
+        /// to be searched dozens of times per frame. The queued events are passed to the widgets by handleQueuedEvents, which
+        /// is called at the start of the draw function.
+        ///
+        /// Events are never reordered: a mouse move is only merged with the previous event when that event was also a mouse move.
+        /// When the queue gets disabled, the events that are still in the queue are handled immediately.
+        ///
+        /// The event queue is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setEventQueueEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether events are queued and passed to the widgets once per frame
+        ///
+        /// @return Does handleEvent store the events instead of handling them immediately?
+        ///
+        /// @see setEventQueueEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEventQueueEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes all events that were queued since the previous call to the widgets
+        ///
+        /// @return Has any of the events been consumed?
+        ///
+        /// This function is called automatically by the draw function. You only have to call it yourself when you want to
+        /// know whether the events were consumed before drawing or when you don't use the draw function of the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool handleQueuedEvents();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many events were received, merged and dispatched during the last call to handleQueuedEvents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const EventQueueStats& getEventQueueStats() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief While tab key usage is enabled (default), pressing tab will focus another widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +228,63 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui would look different when drawing it again
+        ///
+        /// @return Has something changed since the last call to draw, or is a timed change (e.g. a blinking caret) due?
+        ///
+        /// Changes are detected when widgets are added, removed, moved, resized, shown or hidden, change their contents (e.g.
+        /// the text of a label or the value of a slider), get a different renderer property or receive an event, when the
+        /// caret blinks, an animation advances, a tool tip appears or while images are being loaded in the background (see
+        /// TextureManager::setAsyncLoadingEnabled). Changes that aren't made through the widget functions (e.g. drawing on the
+        /// texture of a picture) are not detected, call requestRedraw after making them.
+        ///
+        /// This allows the render loop to sleep while nothing changes:
+        /// @code
+        /// if (gui.isRedrawNeeded())
+        /// {
+        ///     window.clear();
+        ///     gui.draw();
+        ///     window.display();
+        /// }
+        /// else
+        ///     sf::sleep(std::min(gui.getTimeUntilNextChange(), sf::milliseconds(100)));
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRedrawNeeded() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it will take until the gui changes by itself
+        ///
+        /// @return Time until the next caret blink or tool tip, zero while an animation is playing, while images are being
+        ///         loaded in the background or when a redraw is already needed, or the largest time that sf::Time can represent
+        ///         when nothing changes until the user interacts.
+        ///
+        /// The time is measured with the clock that the draw function uses to update the widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextChange() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes isRedrawNeeded return true until the next call to draw
+        ///
+        /// Call this function after changing a widget in a way that isn't detected automatically. The cached bitmaps of all
+        /// widgets (see Widget::setCachedAsBitmap) are redrawn as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestRedraw();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the tool tip that is currently being shown
+        ///
+        /// @return Tool tip of the widget below the mouse, or nullptr when no tool tip is visible
+        ///
+        /// The tool tip isn't added to the gui, it is drawn on top of all widgets by the draw function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getVisibleToolTip() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -310,6 +425,9 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget
+        ///
+        /// The order in which widgets are focused is cached by the gui, so that pressing tab doesn't require searching all
+        /// widgets again. The cache is rebuilt when widgets are added, removed, reordered, shown, hidden, enabled or disabled.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void focusNextWidget();
 
@@ -413,6 +531,52 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the event to the widgets, this is what handleEvent does when the event queue is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool processEvent(sf::Event event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes a mouse event to the popup layer when it occurred on top of a popup. Returns false when the event still has to
+        // be handled by the widgets below the popups.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool handlePopupEvent(sf::Event& event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the cached focus path when the focus changed since the last call. The path is followed by tab navigation
+        // (through the last focused widget of each container, focused or not).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateFocusPath();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Focuses the next or previous widget in the cached tab order.
+        // Returns false when the focus path can't be handled with the tab order, in which case the containers have to search.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool focusWidgetInTabOrder(bool reverse);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widgets in the container that can be focused with the tab key to m_tabOrder
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToTabOrder(const Container& container);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the tool tip of the innermost widget below the mouse, by calling askToolTip on the popup layer or on the
+        // widgets in the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr findToolTipBelowMouse() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the event to the queue, unless it can be merged with an event that is already in the queue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueEvent(const sf::Event& event);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -423,23 +587,52 @@ namespace tgui
         sf::RenderTarget* m_target;
         bool m_windowFocused = true;
 
+        // Value of TextureManager::getFinishedAsyncLoadCount when the widgets were last drawn
+        std::size_t m_finishedAsyncLoadCount = 0;
+
     #if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
         // Does m_target contains a sf::RenderWindow?
         bool m_accessToWindow;
     #endif
 
         // Internal container to store all widgets
-        GuiContainer::Ptr m_container = std::make_shared<GuiContainer>();
+        GuiContainer::Ptr m_container = makePooled<GuiContainer>();
 
+        // The visible tool tip isn't part of the widget tree, it is drawn on top of the widgets next to the mouse
         Widget::Ptr m_visibleToolTip = nullptr;
         sf::Time m_tooltipTime;
         bool m_tooltipPossible = false;
         Vector2f m_lastMousePos;
 
+        // Did the mouse go down on a popup? The mouse events are then passed to the popups until the mouse is released.
+        bool m_mouseDownOnPopup = false;
+
         sf::View m_view;
 
         bool m_TabKeyUsageEnabled = true;
 
+        // Events that are waiting to be passed to the widgets when the event queue is enabled
+        bool m_eventQueueEnabled = false;
+        std::vector<sf::Event> m_queuedEvents;
+        std::vector<sf::Event> m_dispatchedEvents;
+        std::size_t m_receivedEventCount = 0;
+        EventQueueStats m_eventQueueStats;
+
+        // Cached focus path. These pointers remain valid as long as the focus doesn't change, because removing a widget that
+        // is part of the path changes the focus.
+        bool m_focusPathValid = false;
+        unsigned int m_focusPathCounter = 0;
+        Widget* m_tabOrderCurrent = nullptr;    // Widget from where tab navigation starts
+        Container* m_tabOrderScope = nullptr;   // Innermost isolated container in which tab navigation stays
+        bool m_focusPathEndsInContainer = false;
+
+        // Widgets that can be focused with the tab key inside m_tabOrderScope, in the order in which they are focused
+        bool m_tabOrderValid = false;
+        unsigned int m_tabOrderCounter = 0;
+        const Container* m_tabOrderBuiltScope = nullptr;
+        std::vector<Widget*> m_tabOrder;
+        std::unordered_map<const Widget*, std::size_t> m_tabOrderIndices;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_INPUT_VALIDATOR_HPP
+#define TGUI_INPUT_VALIDATOR_HPP
+
+#include <TGUI/Global.hpp>
+#include <SFML/System/String.hpp>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <regex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Checks whether a text matches a regular expression
+    ///
+    /// The pattern is compiled only once, when the validator is constructed. The predefined validators (the patterns found in
+    /// EditBox::Validator) are recognized and handled by hand-written scanners. Other patterns are compiled to a small
+    /// deterministic automaton that works directly on the unicode characters of the text. Only when the pattern uses features
+    /// that can't be expressed that way (e.g. back-references or lookahead) will std::regex be used on the ANSI version of
+    /// the text, in which case isIncremental() returns false.
+    ///
+    /// When the validator is incremental, the text can be checked one character at a time with the getStartState, advance and
+    /// isAccepting functions. This allows the state reached at a certain position to be cached, so that inserting a character
+    /// only requires checking the characters that follow it.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InputValidator
+    {
+    public:
+
+        /// Type used to store the progress of matching a text, for when feeding characters one by one
+        using State = unsigned int;
+
+        /// State which is returned by advance when the text can no longer match, regardless of the characters that follow
+        static constexpr State DeadState = std::numeric_limits<State>::max();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles the regular expression
+        ///
+        /// @param pattern  Regular expression to which the entire text has to match
+        ///
+        /// @throw std::regex_error when the pattern is not a valid regular expression
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InputValidator(const std::string& pattern = ".*");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the regular expression from which the validator was created
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getPattern() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether every possible text is accepted by the validator (e.g. when the pattern is ".*")
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool acceptsEverything() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the pattern could be compiled so that the text can be checked one character at a time
+        ///
+        /// @return False when the validator has to fall back to std::regex and the state functions can't be used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isIncremental() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the entire text matches the pattern
+        ///
+        /// @param text  Text to check
+        ///
+        /// @return True when the text is accepted by the validator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool validate(const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state before the first character of the text
+        ///
+        /// @warning This function may only be called when isIncremental() returns true
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State getStartState() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state after feeding one more character to the validator
+        ///
+        /// @param state      State reached after the previous characters
+        /// @param character  Next character of the text
+        ///
+        /// @return New state, or DeadState when no text that starts with these characters will ever be accepted
+        ///
+        /// @warning This function may only be called when isIncremental() returns true
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State advance(State state, std::uint32_t character) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text is accepted when it ends in the given state
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAccepting(State state) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Tries to turn the pattern into a deterministic automaton, returns false if the pattern isn't supported
+        bool compile();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Transition to another state of the automaton for all characters in the range [first, last]
+        struct Transition
+        {
+            std::uint32_t first;
+            std::uint32_t last;
+            State target;
+        };
+
+        enum class Type
+        {
+            All,
+            UInt,
+            Int,
+            Float,
+            Automaton,
+            Regex
+        };
+
+        std::string m_pattern;
+        Type m_type = Type::All;
+
+        // The transitions of state i are stored in m_transitions, between m_transitionsStart[i] and m_transitionsStart[i+1]
+        std::vector<Transition> m_transitions;
+        std::vector<std::size_t> m_transitionsStart;
+        std::vector<bool> m_acceptingStates;
+
+        std::regex m_regex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INPUT_VALIDATOR_HPP
@@ -145,6 +145,20 @@ namespace tgui
         ~Layout();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Allocates the operands of layout expressions from the MemoryPool while it is enabled
+        ///
+        /// @see MemoryPool::setEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void* operator new(std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the memory of a layout operand to the place it was allocated from
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void operator delete(void* ptr, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Return the cached value of the layout
         ///
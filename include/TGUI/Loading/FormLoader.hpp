@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FORM_LOADER_HPP
+#define TGUI_FORM_LOADER_HPP
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <deque>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Container;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Loads widget files in the background, so that several forms can be prepared in parallel
+    ///
+    /// Reading the widget files, parsing them and decoding the images that they refer to happens on a pool of worker threads.
+    /// Only the construction of the widgets, the upload of the textures and the attachment to the container are left for
+    /// loadWidgets, which has to be called from the main thread.
+    ///
+    /// @code
+    /// tgui::FormLoader loader;
+    /// loader.loadFileAsync("MainMenu.txt");
+    /// loader.loadFileAsync("Settings.txt");
+    /// ...
+    /// loader.loadWidgets(gui, "MainMenu.txt"); // Only waits if the file wasn't completely prepared yet
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FormLoader
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts the worker threads
+        ///
+        /// @param threadCount  Amount of worker threads, or 0 to use as many threads as the hardware supports
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit FormLoader(unsigned int threadCount = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops the worker threads, forms that were still being prepared are discarded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~FormLoader();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FormLoader(const FormLoader&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FormLoader& operator=(const FormLoader&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of worker threads
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getThreadCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts preparing a widget file in the background
+        ///
+        /// @param filename  Filename of the widget file
+        ///
+        /// The resource path and the image loader of the Texture class are captured when this function is called.
+        /// Errors that occur while preparing the file (e.g. the file can't be opened) are only reported by loadWidgets.
+        /// Calling this function again for a file that hasn't been passed to loadWidgets yet has no effect.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFileAsync(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a widget file has been completely prepared, so that loadWidgets won't have to wait
+        ///
+        /// @param filename  Filename that was passed to loadFileAsync
+        ///
+        /// @return True when the file is ready, false when it is still being prepared or when loadFileAsync wasn't called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLoaded(const std::string& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the widgets inside a container with the ones from a widget file
+        ///
+        /// @param container  Container to which the widgets will be added
+        /// @param filename   Filename of the widget file
+        ///
+        /// If the file is still being prepared then this function waits for it to finish. If loadFileAsync wasn't called for
+        /// this file then it is prepared now. The prepared data is released afterwards, so loading the same file again
+        /// requires another call to loadFileAsync.
+        ///
+        /// @throw Exception when the file could not be opened or parsed, or when one of the widgets fails to load
+        ///
+        /// @warning This function must be called from the main thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgets(Container& container, const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Form
+        {
+            std::unique_ptr<DataIO::Node> rootNode;
+            std::map<sf::String, std::unique_ptr<sf::Image>> images;
+            std::size_t pendingTasks = 0;
+            std::exception_ptr error;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads and parses the widget file and then schedules decoding the images that it references
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prepareForm(const std::shared_ptr<Form>& form, const std::string& filename, const std::string& resourcePath,
+                         const std::function<std::unique_ptr<sf::Image>(const sf::String&)>& imageLoader);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks one of the tasks of a form as finished. The mutex has to be locked when calling this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishTask(Form& form);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a task to the queue. The mutex has to be locked when calling this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTask(std::function<void()> task);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Function executed by the worker threads
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void runWorker();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<std::thread> m_threads;
+        std::deque<std::function<void()>> m_tasks;
+        std::map<std::string, std::shared_ptr<Form>> m_forms;
+        bool m_stopping = false;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_taskAdded;
+        std::condition_variable m_taskFinished;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FORM_LOADER_HPP
@@ -166,6 +166,8 @@ namespace tgui
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+
+        friend class MemoryUsage; // Reads m_renderers to report their memory
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
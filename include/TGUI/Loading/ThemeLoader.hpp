@@ -163,6 +163,7 @@ namespace tgui
         static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
 
         friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
+        friend class MemoryUsage; // Reads m_propertiesCache to report the memory of the cache
     };
 
 
@@ -0,0 +1,200 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_MEMORY_POOL_HPP
+#define TGUI_MEMORY_POOL_HPP
+
+#include <TGUI/Config.hpp>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Pool from which widgets and their small internal objects are allocated
+    ///
+    /// Memory is handed out in blocks of a few fixed sizes. Blocks that are freed are reused for the next allocation of the
+    /// same size, so creating and destroying many widgets (e.g. when recycling rows or opening popups) no longer fragments the
+    /// heap and mostly avoids calls to the global operator new. Memory that was reserved by the pool is never returned
+    /// to the system while the program is running.
+    ///
+    /// Allocations larger than MaxBlockSize are passed to the global operator new.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MemoryPool
+    {
+    public:
+
+        /// Largest allocation that is served by the pool
+        static constexpr std::size_t MaxBlockSize = 4096;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Allocates memory from the pool
+        ///
+        /// @param bytes  Amount of bytes to allocate
+        ///
+        /// @return Pointer to memory that is suitably aligned for any fundamental type
+        ///
+        /// @throw std::bad_alloc when no memory could be reserved
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void* allocate(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns memory to the pool
+        ///
+        /// @param ptr    Pointer that was returned by allocate
+        /// @param bytes  Amount of bytes that was passed to allocate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void deallocate(void* ptr, std::size_t bytes) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether new widgets and their containers are allocated from the pool
+        ///
+        /// @param enabled  Should PoolAllocator objects and layout operands that are created from now on use the pool?
+        ///
+        /// Objects that were already allocated are always released to the place they came from, so this function can be called
+        /// at any time. It is mainly useful to compare the amount of allocations with and without the pool. Enabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether new widgets and their containers are allocated from the pool
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that the pool has reserved from the system
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getReservedBytes();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of reserved memory that is currently handed out, rounded up to the block sizes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getUsedBytes();
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Allocator that can be passed to standard containers and std::allocate_shared to allocate from the MemoryPool
+    ///
+    /// Whether the pool is used is decided when the allocator is constructed (see MemoryPool::setEnabled). The decision is
+    /// stored inside the allocator and is propagated together with it, so memory is always released to where it came from.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class PoolAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+        using is_always_equal = std::false_type;
+
+        PoolAllocator() :
+            m_usePool{MemoryPool::isEnabled()}
+        {
+        }
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& other) :
+            m_usePool{other.isUsingPool()}
+        {
+        }
+
+        T* allocate(std::size_t count)
+        {
+            if (canUsePool())
+                return static_cast<T*>(MemoryPool::allocate(count * sizeof(T)));
+            else
+                return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, std::size_t count) noexcept
+        {
+            if (canUsePool())
+                MemoryPool::deallocate(ptr, count * sizeof(T));
+            else
+                ::operator delete(ptr);
+        }
+
+        bool isUsingPool() const
+        {
+            return m_usePool;
+        }
+
+    private:
+
+        // The pool only guarantees the alignment of fundamental types
+        bool canUsePool() const
+        {
+            return m_usePool && (alignof(T) <= alignof(std::max_align_t));
+        }
+
+    private:
+
+        bool m_usePool;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const PoolAllocator<T>& left, const PoolAllocator<U>& right)
+    {
+        return left.isUsingPool() == right.isUsingPool();
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const PoolAllocator<T>& left, const PoolAllocator<U>& right)
+    {
+        return !(left == right);
+    }
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Creates an object managed by a shared_ptr, with the object and its reference count allocated from the MemoryPool
+    ///
+    /// This is what the create and clone functions of the widgets use instead of std::make_shared.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T, typename... Args>
+    std::shared_ptr<T> makePooled(Args&&... args)
+    {
+        return std::allocate_shared<T>(PoolAllocator<T>{}, std::forward<Args>(args)...);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MEMORY_POOL_HPP
@@ -0,0 +1,369 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_MEMORY_USAGE_HPP
+#define TGUI_MEMORY_USAGE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <set>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace sf
+{
+    class Font;
+}
+
+namespace tgui
+{
+    class Gui;
+    class Text;
+    class Theme;
+    class Widget;
+    class ObjectConverter;
+    struct RendererData;
+    struct TextureData;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Reports how many bytes are held by the different parts of TGUI
+    ///
+    /// A newly constructed object already contains the memory of the global caches: the images and textures that were loaded
+    /// by the TextureManager and the theme files cached by DefaultThemeLoader. The memory of widgets, themes and fonts is added
+    /// by calling addGui, addWidget or addTheme. Resources that are shared (renderer data, textures and font pages) are
+    /// only counted once, no matter how many widgets use them.
+    ///
+    /// The numbers are estimates: the sizes of images, textures, strings and vertices are counted, but the bookkeeping done
+    /// by the standard containers and by the graphics driver is not.
+    ///
+    /// Counting allocations is done separately, with the static functions of this class. TGUI itself never replaces the global
+    /// operator new, but when TGUI_DEFINE_ALLOCATION_HOOKS() is placed in one source file of the application, all allocations
+    /// made by the program are counted and getLastFrameAllocations() tells how many of them occurred during the last frame.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MemoryUsage
+    {
+    public:
+
+        /// Allocations counted by the allocation hooks
+        struct AllocationStats
+        {
+            std::size_t allocations = 0;    ///< Amount of times memory was allocated
+            std::size_t deallocations = 0;  ///< Amount of times memory was freed
+            std::size_t bytesAllocated = 0; ///< Total amount of bytes that were allocated
+            std::size_t bytesFreed = 0;     ///< Total amount of bytes that were freed
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a report that contains the memory held by the TextureManager and the DefaultThemeLoader cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the memory of all widgets in the gui, including the font pages of the global font that they use
+        ///
+        /// @param gui  Gui of which the widgets have to be counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addGui(const Gui& gui);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the memory of a widget, its renderer and, for containers, all widgets inside it
+        ///
+        /// @param widget  Widget that has to be counted
+        ///
+        /// Adding the same widget twice has no effect.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidget(const Widget& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the memory of the renderers that were loaded by a theme
+        ///
+        /// @param theme  Theme of which the renderers have to be counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTheme(const Theme& theme);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bytes of the images and alpha masks which are kept in RAM for the textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTextureImageBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bytes of video memory used by the textures, including the textures of widgets cached as bitmap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTextureGpuBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bytes of video memory used by the glyph pages of the fonts that are used by the counted texts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getFontBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bytes of the theme files that are cached by the DefaultThemeLoader
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getThemeCacheBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bytes of the property maps of the counted renderers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getRendererDataBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the bytes of the counted widgets, including their strings and texts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getWidgetBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the sum of all the other getters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTotalBytes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds memory that belongs to the widget that is being counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addWidgetBytes(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds the characters of a string to the memory of the widget that is being counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addString(const sf::String& string);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds a text to the memory of the widget that is being counted, together with the font page that it uses
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addText(const Text& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds renderer data and the textures and nested renderers in it, unless it was already counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addRendererData(const std::shared_ptr<RendererData>& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds the image and texture of texture data, unless it was already counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTextureData(const std::shared_ptr<TextureData>& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Adds video memory that isn't shared, such as the texture of a widget that is cached as bitmap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTextureGpuBytes(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counts an allocation. This function is called by the hooks defined with TGUI_DEFINE_ALLOCATION_HOOKS().
+        ///
+        /// @param bytes  Size of the allocated memory
+        ///
+        /// This function is thread-safe and doesn't allocate memory itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void recordAllocation(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counts a deallocation. This function is called by the hooks defined with TGUI_DEFINE_ALLOCATION_HOOKS().
+        ///
+        /// @param bytes  Size of the freed memory
+        ///
+        /// This function is thread-safe and doesn't allocate memory itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void recordDeallocation(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the allocations that were counted since the last frame ended
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static AllocationStats getCurrentFrameAllocations();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the allocations that were counted during the last frame
+        ///
+        /// A frame ends when Gui::draw returns. All zeros are returned when the allocation hooks aren't defined.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static AllocationStats getLastFrameAllocations();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Ends the current frame. This function is called by Gui::draw.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Adds the value stored in a property of a renderer
+        void addObjectConverter(const ObjectConverter& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::size_t m_textureImageBytes = 0;
+        std::size_t m_textureGpuBytes = 0;
+        std::size_t m_fontBytes = 0;
+        std::size_t m_themeCacheBytes = 0;
+        std::size_t m_rendererDataBytes = 0;
+        std::size_t m_widgetBytes = 0;
+
+        // Shared objects that were already counted
+        std::set<const void*> m_countedObjects;
+        std::set<std::pair<const sf::Font*, unsigned int>> m_countedFontPages;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @internal
+/// @brief Replaces the global operator new and delete that take an alignment (only when the compiler supports them)
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if defined(__cpp_aligned_new)
+    #define TGUI_DEFINE_ALIGNED_ALLOCATION_HOOKS() \
+        void* operator new(std::size_t size, std::align_val_t alignment) { return tgui::priv::hookedAllocateOrThrow(size, static_cast<std::size_t>(alignment)); } \
+        void* operator new[](std::size_t size, std::align_val_t alignment) { return tgui::priv::hookedAllocateOrThrow(size, static_cast<std::size_t>(alignment)); } \
+        void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return tgui::priv::hookedAllocateNothrow(size, static_cast<std::size_t>(alignment)); } \
+        void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return tgui::priv::hookedAllocateNothrow(size, static_cast<std::size_t>(alignment)); } \
+        void operator delete(void* ptr, std::align_val_t) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+        void operator delete[](void* ptr, std::align_val_t) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+        void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+        void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+        void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+        void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { tgui::priv::hookedDeallocate(ptr); }
+#else
+    #define TGUI_DEFINE_ALIGNED_ALLOCATION_HOOKS()
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Replaces the global operator new and delete by versions that call MemoryUsage::recordAllocation/recordDeallocation
+///
+/// This macro has to be placed in exactly one source file of the application, outside of any namespace.
+/// Every allocation is preceded by a small header in which the requested size and the start of the allocated block are
+/// stored, so that the unsized operator delete can also tell how many bytes are freed. All forms of new and delete
+/// (including the nothrow and aligned versions) are replaced, so that memory is never freed by a function that didn't
+/// allocate it. Like the standard versions, they keep calling the installed new handler while the allocation fails.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define TGUI_DEFINE_ALLOCATION_HOOKS() \
+    namespace tgui { namespace priv { \
+        inline void* hookedAllocate(std::size_t size, std::size_t alignment) noexcept \
+        { \
+            const std::size_t headerSize = sizeof(std::size_t) + sizeof(void*); \
+            if (alignment < alignof(std::max_align_t)) \
+                alignment = alignof(std::max_align_t); \
+            if (size > static_cast<std::size_t>(-1) - headerSize - alignment) \
+                return nullptr; \
+            void* block = std::malloc(size + headerSize + alignment); \
+            if (!block) \
+                return nullptr; \
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(block) + headerSize; \
+            char* ptr = reinterpret_cast<char*>((address + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1)); \
+            std::memcpy(ptr - headerSize, &size, sizeof(std::size_t)); \
+            std::memcpy(ptr - sizeof(void*), &block, sizeof(void*)); \
+            tgui::MemoryUsage::recordAllocation(size); \
+            return ptr; \
+        } \
+        inline void* hookedAllocateOrThrow(std::size_t size, std::size_t alignment) \
+        { \
+            while (true) \
+            { \
+                void* ptr = hookedAllocate(size, alignment); \
+                if (ptr) \
+                    return ptr; \
+                const std::new_handler handler = std::get_new_handler(); \
+                if (!handler) \
+                    throw std::bad_alloc{}; \
+                handler(); \
+            } \
+        } \
+        inline void* hookedAllocateNothrow(std::size_t size, std::size_t alignment) noexcept \
+        { \
+            try \
+            { \
+                return hookedAllocateOrThrow(size, alignment); \
+            } \
+            catch (...) \
+            { \
+                return nullptr; \
+            } \
+        } \
+        inline void hookedDeallocate(void* ptr) noexcept \
+        { \
+            if (!ptr) \
+                return; \
+            std::size_t size; \
+            void* block; \
+            std::memcpy(&size, static_cast<char*>(ptr) - sizeof(std::size_t) - sizeof(void*), sizeof(std::size_t)); \
+            std::memcpy(&block, static_cast<char*>(ptr) - sizeof(void*), sizeof(void*)); \
+            tgui::MemoryUsage::recordDeallocation(size); \
+            std::free(block); \
+        } \
+    } } \
+    void* operator new(std::size_t size) { return tgui::priv::hookedAllocateOrThrow(size, alignof(std::max_align_t)); } \
+    void* operator new[](std::size_t size) { return tgui::priv::hookedAllocateOrThrow(size, alignof(std::max_align_t)); } \
+    void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return tgui::priv::hookedAllocateNothrow(size, alignof(std::max_align_t)); } \
+    void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return tgui::priv::hookedAllocateNothrow(size, alignof(std::max_align_t)); } \
+    void operator delete(void* ptr) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+    void operator delete[](void* ptr) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+    void operator delete(void* ptr, std::size_t) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+    void operator delete[](void* ptr, std::size_t) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+    void operator delete(void* ptr, const std::nothrow_t&) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+    void operator delete[](void* ptr, const std::nothrow_t&) noexcept { tgui::priv::hookedDeallocate(ptr); } \
+    TGUI_DEFINE_ALIGNED_ALLOCATION_HOOKS()
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MEMORY_USAGE_HPP
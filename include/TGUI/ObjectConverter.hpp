@@ -376,6 +376,8 @@ namespace tgui
 
         bool m_serialized = false;
         sf::String m_string;
+
+        friend class MemoryUsage; // Reads the stored value without converting it
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,166 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_POPUP_LAYER_HPP
+#define TGUI_POPUP_LAYER_HPP
+
+
+#include <TGUI/Container.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Layer of the gui in which popups (e.g. the list of a combo box or an open menu) are shown
+    ///
+    /// The popup layer is owned by the GuiContainer but isn't one of its child widgets. It is drawn after all other widgets
+    /// and mouse events are passed to it before they reach the widgets below it, so opening and closing a popup never
+    /// changes the widget tree. The position of a popup is relative to the gui.
+    ///
+    /// A popup belongs to another widget. It is closed automatically when that widget is destroyed or removed from the gui.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PopupLayer : public Container
+    {
+    public:
+
+        typedef std::shared_ptr<PopupLayer> Ptr; ///< Shared widget pointer
+        typedef std::shared_ptr<const PopupLayer> ConstPtr; ///< Shared constant widget pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param guiContainer  Container of the gui to which the layer belongs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PopupLayer(GuiContainer* guiContainer);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows a popup on top of all widgets in the gui
+        ///
+        /// @param popup  Widget to show, its position is relative to the gui
+        /// @param owner  Widget that opens the popup
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void openPopup(const Widget::Ptr& popup, const Widget::Ptr& owner);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Closes a popup
+        ///
+        /// @param popup  Popup that was opened with openPopup
+        ///
+        /// @return True when the popup was closed, false when it wasn't open
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool closePopup(const Widget::Ptr& popup);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the popup that was opened by a widget
+        ///
+        /// @param owner  Widget that was passed to openPopup
+        ///
+        /// @return Popup of the widget, or nullptr when the widget has no open popup
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getPopupOfOwner(const Widget* owner) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a popup from the layer
+        ///
+        /// @param widget  Popup to close
+        ///
+        /// @return True when the popup was closed, false when it wasn't open
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool remove(const Widget::Ptr& widget) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Closes all popups
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the mouse position (which is relative to the gui) lies on top of one of the popups
+        ///
+        /// @return Is the mouse on top of a popup?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mouseOnWidget(Vector2f pos) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Updates the popups and closes the ones of which the owner no longer belongs to the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(sf::Time elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the popups
+        ///
+        /// @param target Render target to draw to
+        /// @param states Current render states
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The popup layer can't be copied
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr clone() const override
+        {
+            return nullptr;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gives the focus back to the gui once all popups are closed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseFocusWhenEmpty();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // The owner of each popup, in the same order as m_widgets
+        std::vector<std::weak_ptr<Widget>> m_owners;
+
+        GuiContainer* m_guiContainer;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_POPUP_LAYER_HPP
@@ -0,0 +1,251 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROFILER_HPP
+#define TGUI_PROFILER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Global.hpp>
+#include <SFML/System/Time.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Measures the time spent updating, handling events and drawing, per frame and per widget
+    ///
+    /// The measurements are only made when TGUI was built with the TGUI_ENABLE_PROFILER option. Without that option, none of
+    /// the instrumentation is compiled into the library, isAvailable() returns false and the profiler never records anything.
+    /// Even when the profiler is available, nothing is recorded until setEnabled(true) is called.
+    ///
+    /// A frame ends when Gui::draw returns, so a frame contains all events that were handled since the previous draw.
+    /// The times per widget are exclusive: the time spent in the children of a container is not counted in the container.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Profiler
+    {
+    public:
+
+        /// The kind of work that is being measured
+        enum class Category
+        {
+            Update, ///< Gui::updateTime and Widget::update
+            Event,  ///< Gui::handleEvent and the event functions of the widgets
+            Draw    ///< Gui::draw and Widget::draw
+        };
+
+        /// Time spent in each category
+        struct Times
+        {
+            sf::Time update;
+            sf::Time event;
+            sf::Time draw;
+        };
+
+        /// Measurements for a single widget
+        struct WidgetStats
+        {
+            std::string type;       ///< Type of the widget
+            Times       times;      ///< Time spent in the widget itself, excluding the time spent in its children
+            std::size_t calls = 0;  ///< Amount of times the widget was updated, received an event or was drawn
+        };
+
+        /// Measurements of a single frame
+        struct FrameStats
+        {
+            std::size_t frameNumber = 0;  ///< Index of the frame since the profiler was enabled
+            Times       gui;              ///< Total time spent in Gui::updateTime, Gui::handleEvent and Gui::draw
+            std::size_t drawCalls = 0;    ///< Amount of draw calls that TGUI made on the render target
+            std::size_t clippings = 0;    ///< Amount of Clipping objects that were created (each one changes the view)
+            std::size_t glyphMisses = 0;  ///< Amount of glyphs that had to be rendered by the font because they weren't loaded yet
+
+            std::map<std::string, Times> widgetTypes;         ///< Exclusive times per widget type
+            std::map<const Widget*, WidgetStats> widgets;     ///< Exclusive times per widget, the pointers may no longer be valid
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the profiler was compiled into the library
+        ///
+        /// @return True when TGUI was built with TGUI_ENABLE_PROFILER, false when the profiler will never record anything
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAvailable();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts or stops recording
+        ///
+        /// @param enabled  Should measurements be made?
+        ///
+        /// The profiler is disabled by default. Enabling it again does not clear the frames that were already recorded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the profiler is recording
+        ///
+        /// @return Is the profiler enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of frames that are kept, older frames are discarded
+        ///
+        /// @param frames  Maximum amount of recorded frames
+        ///
+        /// By default the last 120 frames are kept.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMaxRecordedFrames(std::size_t frames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of frames that are kept
+        ///
+        /// @return Maximum amount of recorded frames
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getMaxRecordedFrames();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the measurements of the recorded frames, the oldest frame first
+        ///
+        /// @return Statistics of the frames that were completed while the profiler was enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<FrameStats> getRecordedFrames();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the measurements of the last frame that was completed
+        ///
+        /// @return Statistics of the last frame, or empty statistics when no frame was recorded yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FrameStats getLastFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all recorded frames
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the recorded frames to a file in the Chrome trace event format
+        ///
+        /// @param filename  Name of the json file to create
+        ///
+        /// The file can be opened with chrome://tracing or other trace viewers such as Perfetto.
+        ///
+        /// @throw Exception when the file could not be opened for writing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void saveChromeTrace(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Marks the end of a frame, this is called by Gui::draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Counts draw calls on the render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addDrawCalls(std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Counts the creation of a Clipping object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addClipping();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Counts a glyph that the font had to render because it wasn't used before
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addGlyphMiss();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Measures the time between its construction and destruction. The widget is a nullptr for the gui itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Scope
+        {
+        public:
+            Scope(Category category, const Widget* widget);
+            ~Scope();
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            bool m_active;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static bool m_enabled;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The instrumentation inside the library, which is removed completely when the profiler isn't compiled in
+#ifdef TGUI_ENABLE_PROFILER
+    #define TGUI_PROFILER_CONCAT_IMPL(a, b) a##b
+    #define TGUI_PROFILER_CONCAT(a, b) TGUI_PROFILER_CONCAT_IMPL(a, b)
+
+    #define TGUI_PROFILE_SCOPE(category, widget) tgui::Profiler::Scope TGUI_PROFILER_CONCAT(profilerScope, __LINE__){tgui::Profiler::Category::category, widget}
+    #define TGUI_PROFILE_END_FRAME() tgui::Profiler::endFrame()
+    #define TGUI_PROFILE_DRAW_CALLS(count) tgui::Profiler::addDrawCalls(count)
+    #define TGUI_PROFILE_CLIPPING() tgui::Profiler::addClipping()
+    #define TGUI_PROFILE_GLYPH_MISS() tgui::Profiler::addGlyphMiss()
+#else
+    #define TGUI_PROFILE_SCOPE(category, widget) ((void)0)
+    #define TGUI_PROFILE_END_FRAME() ((void)0)
+    #define TGUI_PROFILE_DRAW_CALLS(count) ((void)0)
+    #define TGUI_PROFILE_CLIPPING() ((void)0)
+    #define TGUI_PROFILE_GLYPH_MISS() ((void)0)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_HPP
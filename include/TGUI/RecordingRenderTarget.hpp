@@ -0,0 +1,190 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RECORDING_RENDER_TARGET_HPP
+#define TGUI_RECORDING_RENDER_TARGET_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target that records what TGUI draws on it instead of drawing it with OpenGL
+    ///
+    /// The target can be passed to a Gui like any other render target. Every draw call that TGUI makes is then stored as a
+    /// DrawCommand, together with the part of the target to which the drawing is clipped. This allows drawing widgets
+    /// without creating a window or render texture, e.g. to benchmark the drawing code or to compare what is being drawn.
+    ///
+    /// Only draws made by TGUI are recorded, drawing an SFML object directly on the target (e.g. with target.draw) does
+    /// nothing. The recording keeps growing until clearCommands() is called, calling clear() on the target has no effect.
+    ///
+    /// Note that text still needs the glyph textures of the font, for which SFML may create an OpenGL context.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RecordingRenderTarget : public sf::RenderTarget
+    {
+    public:
+
+        /// A single recorded draw call
+        struct DrawCommand
+        {
+            enum class Type
+            {
+                Vertices, ///< Vertices were drawn directly, vertices contains them in the original order
+                Shape,    ///< A shape was drawn, vertices contains its points as a triangle fan in the fill color
+                Text,     ///< A text was drawn, the vertices are empty
+                Sprite    ///< A sprite was drawn, vertices contains the 4 corners as a triangle strip
+            };
+
+            Type              type = Type::Vertices;
+            sf::PrimitiveType primitiveType = sf::PrimitiveType::TrianglesStrip;
+            sf::Transform     transform;                ///< Transformation that is applied to the vertices
+            sf::BlendMode     blendMode;
+            const sf::Texture* texture = nullptr;
+            const sf::Shader*  shader = nullptr;
+            sf::IntRect       clipRect;                 ///< Part of the target in pixels outside which nothing is drawn
+            std::vector<sf::Vertex> vertices;
+
+            sf::Color    outlineColor;                  ///< Outline color of a shape or text
+            float        outlineThickness = 0;          ///< Outline thickness of a shape or text
+
+            sf::String   string;                        ///< String of a text
+            unsigned int characterSize = 0;             ///< Character size of a text
+            sf::Uint32   style = 0;                     ///< Style of a text
+            sf::Color    color;                         ///< Fill color of a text
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param size  Size of the target in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RecordingRenderTarget(sf::Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~RecordingRenderTarget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the target
+        ///
+        /// @return Size of the target in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2u getSize() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the draw commands that were recorded since the last call to clearCommands
+        ///
+        /// @return Recorded draw calls, in the order in which they were made
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<DrawCommand>& getCommands() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all recorded draw commands
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearCommands();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a readable description of the recorded draw commands
+        ///
+        /// @return String with one line per draw command
+        ///
+        /// The output only depends on what was drawn (e.g. textures are described by their size instead of their address),
+        /// so it can be compared between runs.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::string toString() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the target as recording target when it is one, or a nullptr when draws have to be made on the target itself
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static RecordingRenderTarget* getRecordingTarget(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Stores a draw command
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void record(DrawCommand&& command, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        // Never activate an OpenGL context, which also turns calls to clear and draw on the target into no-ops
+        bool setActive(bool active = true) override;
+    #else
+        bool activate(bool active) override;
+    #endif
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::Vector2u m_size;
+        std::vector<DrawCommand> m_commands;
+
+        // Amount of recording targets that exist, so that normal targets don't have to be checked while there are none
+        static unsigned int m_recordingTargetCount;
+    };
+
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Functions through which all draw calls of the library are made. They record the draw call when the target is a
+        // RecordingRenderTarget, count it for the profiler and apply the draw opacity (see DrawOpacity.hpp).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_API void drawVertices(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states);
+        TGUI_API void drawShape(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states);
+        TGUI_API void drawText(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states);
+        TGUI_API void drawSprite(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RECORDING_RENDER_TARGET_HPP
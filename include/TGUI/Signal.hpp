@@ -31,6 +31,7 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/MemoryPool.hpp>
 #include <SFML/System/String.hpp>
 #include <functional>
 #include <typeindex>
@@ -164,6 +165,17 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether any signal handlers are connected to this signal
+        ///
+        /// This allows a widget to skip preparing expensive parameters when nobody is listening to the signal.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isConnected() const
+        {
+            return !m_handlers.empty();
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the name given to the signal
         ///
@@ -197,7 +209,7 @@ namespace tgui
     protected:
 
         std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        std::map<unsigned int, std::function<void()>, std::less<unsigned int>, PoolAllocator<std::pair<const unsigned int, std::function<void()>>>> m_handlers;
     };
 
 
@@ -732,7 +744,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        std::map<unsigned int, std::string> m_connectedSignals;
+        std::map<unsigned int, std::string, std::less<unsigned int>, PoolAllocator<std::pair<const unsigned int, std::string>>> m_connectedSignals;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -212,9 +212,9 @@ namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the location of the vertices
+        // Update the location of the vertices. This is also done while drawing when the texture finished loading asynchronously.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateVertices();
+        void updateVertices() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,14 +222,15 @@ namespace tgui
 
         Vector2f    m_size;
         Texture     m_texture;
-        std::vector<sf::Vertex> m_vertices;
+        mutable std::shared_ptr<std::vector<sf::Vertex>> m_vertices; // Shared with copies of the sprite until either one changes
+        mutable bool m_verticesForLoadingTexture = false;
 
         FloatRect   m_visibleRect;
 
         Color       m_vertexColor = Color::White;
         float       m_opacity = 1;
 
-        ScalingType m_scalingType = ScalingType::Normal;
+        mutable ScalingType m_scalingType = ScalingType::Normal;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,8 +33,14 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/PopupLayer.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
+#include <TGUI/MemoryPool.hpp>
+#include <TGUI/MemoryUsage.hpp>
 
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/FormLoader.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
@@ -258,6 +258,18 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the sf::Text after making a copy of it when it is still shared with another Text object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Text& getModifiableText();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the sf::Text that is shared by all texts that haven't been changed yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const std::shared_ptr<sf::Text>& getEmptyText();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Calculates the size of the text again after something changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,11 +279,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        sf::Text     m_text;
+        // Copies of a Text share the sf::Text (and thus its string and vertices) until one of them is changed
+        std::shared_ptr<sf::Text> m_text = getEmptyText();
         Vector2f     m_size;
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+
+        friend class MemoryUsage; // Checks whether the sf::Text is shared with another text
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
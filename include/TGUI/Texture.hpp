@@ -208,6 +208,18 @@ namespace tgui
         Vector2f getImageSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the image is still being loaded in the background
+        ///
+        /// @return True when async loading is enabled and the image hasn't finished loading yet, in which case the image size
+        ///         is still 0x0
+        ///
+        /// @see TextureManager::setAsyncLoadingEnabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLoading() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Enables or disable the smooth filter
         ///
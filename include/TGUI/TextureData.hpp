@@ -35,8 +35,12 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Shader.hpp>
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -49,8 +53,20 @@ namespace tgui
     {
         std::unique_ptr<sf::Image> image;
         sf::Texture texture;
+
+        // One bit per pixel of the texture (row by row), set when the pixel is fully transparent.
+        // When the TextureManager creates this mask, it no longer keeps the image in memory.
+        std::vector<std::uint32_t> alphaMask;
         sf::IntRect rect;
         sf::Shader* shader = nullptr;
+
+        // Set while the image is still being decoded or uploaded in the background (see TextureManager::setAsyncLoadingEnabled)
+        bool loading = false;
+
+        // Functions that are called once the texture finished loading in the background, so that the widgets that use the
+        // texture can use the real size of the image. Each function is stored together with the object that added it, so
+        // that the object can remove its functions again when it is destroyed before the texture is loaded.
+        std::vector<std::pair<const void*, std::function<void()>>> loadedCallbacks;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
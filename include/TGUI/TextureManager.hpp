@@ -79,10 +79,123 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether loaded images are replaced by an alpha mask
+        ///
+        /// @param enabled  Should only the transparency of the pixels be kept in memory?
+        ///
+        /// Widgets need to know which pixels of their texture are transparent to ignore mouse events on those pixels. By default
+        /// a copy of the image is kept in memory for this. When the alpha mask is enabled, the manager instead stores one bit
+        /// per pixel telling whether the pixel is transparent and then frees the image.
+        ///
+        /// This setting only affects images that are loaded after calling this function. It is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAlphaMaskEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether loaded images are replaced by an alpha mask
+        ///
+        /// @return Is only the transparency of the pixels kept in memory?
+        ///
+        /// @see setAlphaMaskEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAlphaMaskEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images are decoded on a background thread
+        ///
+        /// @param enabled  Should getTexture return before the image has been loaded?
+        ///
+        /// When enabled, getTexture no longer loads the image itself. The image loader (Texture::getImageLoader) is called on a
+        /// background thread instead, after which the image is uploaded to the GPU in parts by uploadDecodedImages.
+        /// Until then the texture is empty and TextureData::loading is set, so the sprites that use it draw nothing.
+        /// The size of the image isn't known before it has been decoded. Widgets that use the texture in their renderer
+        /// (e.g. a Picture without a size) update their size and layout once the texture has finished loading.
+        /// Errors are not reported: a texture whose image couldn't be loaded remains empty.
+        /// The Gui redraws its widgets (including the ones that are cached as a bitmap) once a texture has finished loading.
+        ///
+        /// This setting only affects images that are requested after calling this function. It is disabled by default.
+        ///
+        /// @warning The image loader has to be thread-safe when async loading is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncLoadingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images are decoded on a background thread
+        ///
+        /// @see setAsyncLoadingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAsyncLoadingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of pixel data that uploadDecodedImages sends to the GPU in a single call
+        ///
+        /// @param bytes  Budget in bytes (4 bytes per pixel), or 0 to upload all decoded images at once
+        ///
+        /// Larger images are uploaded a few rows at a time, spread over multiple frames. At least one row is uploaded per call
+        /// so that loading always progresses. The default budget is 4 MB.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setUploadBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of pixel data that uploadDecodedImages sends to the GPU in a single call
+        ///
+        /// @see setUploadBudget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getUploadBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Uploads images that were decoded in the background to their textures
+        ///
+        /// @param ignoreBudget  Upload everything that has been decoded, regardless of the budget
+        ///
+        /// This function is called by Gui::draw each frame, you only need to call it yourself when not using the Gui class.
+        /// It must be called from the thread that owns the OpenGL context.
+        ///
+        /// @return True when at least one texture finished loading
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool uploadDecodedImages(bool ignoreBudget = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that finished loading in the background since the program started
+        ///
+        /// Every gui compares this value with the one it saw before to find out whether its widgets have to be redrawn, even
+        /// when the textures were uploaded while another gui was being drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getFinishedAsyncLoadCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that are still being decoded or uploaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getPendingAsyncLoadCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all textures that were requested asynchronously have been decoded and uploaded
+        ///
+        /// This function must be called from the thread that owns the OpenGL context.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void finishAsyncLoading();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        static bool m_alphaMaskEnabled;
+        static bool m_asyncLoadingEnabled;
+        static std::size_t m_uploadBudget;
+        static std::size_t m_finishedAsyncLoadCount;
+
+        friend class MemoryUsage; // Reads m_imageMap to report the memory of the loaded images
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,12 +38,14 @@
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/Animation.hpp>
 #include <TGUI/Aurora/SmartPtr/CopiedPtr.hpp>
 #include <TGUI/Aurora/Tools/Downcast.hpp>
 
 #include <SFML/System/Time.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 #include <unordered_set>
 
@@ -58,12 +60,8 @@
 namespace tgui
 {
     class Container;
-
-    enum class ShowAnimationType;
-    namespace priv
-    {
-        class Animation;
-    }
+    class GuiContainer;
+    class MemoryUsage;
 
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -295,6 +293,62 @@ namespace tgui
         virtual void hideWithEffect(ShowAnimationType type, sf::Time duration);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves the widget from its current position to a new position with an animation
+        ///
+        /// @param position  Position of the widget at the end of the animation
+        /// @param duration  Duration of the animation
+        /// @param easing    Curve that determines how fast the widget moves during the animation
+        ///
+        /// If the widget was already moving then the previous animation is finished immediately.
+        /// The position is set as a constant, layouts that were used for the position are no longer followed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void moveWithAnimation(Vector2f position, sf::Time duration, EasingType easing = EasingType::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resizes the widget from its current size to a new size with an animation
+        ///
+        /// @param size      Size of the widget at the end of the animation
+        /// @param duration  Duration of the animation
+        /// @param easing    Curve that determines how fast the widget grows or shrinks during the animation
+        ///
+        /// If the widget was already being resized then the previous animation is finished immediately.
+        /// The size is set as a constant, layouts that were used for the size are no longer followed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeWithAnimation(Vector2f size, sf::Time duration, EasingType easing = EasingType::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the inherited opacity of the widget from its current value to a new value with an animation
+        ///
+        /// @param opacity   Inherited opacity at the end of the animation, between 0 (transparent) and 1 (opaque)
+        /// @param duration  Duration of the animation
+        /// @param easing    Curve that determines how fast the opacity changes during the animation
+        ///
+        /// Unlike hideWithEffect, the widget remains visible when the opacity reaches 0.
+        ///
+        /// @see setInheritedOpacity
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void fadeWithAnimation(float opacity, sf::Time duration, EasingType easing = EasingType::Linear);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a color in the renderer of the widget from its current value to a new value with an animation
+        ///
+        /// @param property  Name of the renderer property, e.g. "BackgroundColor"
+        /// @param color     Color at the end of the animation
+        /// @param duration  Duration of the animation
+        /// @param easing    Curve that determines how fast the color changes during the animation
+        ///
+        /// When the property doesn't have a color yet, it will be set to the new color immediately.
+        ///
+        /// @warning The renderer property is changed during the animation, so when the renderer is shared with other widgets
+        ///          (e.g. because it was loaded from a theme) then these widgets will change color as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void animateRendererColor(const std::string& property, Color color, sf::Time duration, EasingType easing = EasingType::Linear);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Shows or hides a widget
         /// @param visible  Is the widget visible?
@@ -449,6 +503,8 @@ namespace tgui
         /// @brief Sets the opacity of the widget that will be multiplied with the opacity set in the renderer
         ///
         /// @param opacity  Opacity of the widget
+        ///
+        /// The opacity of the parents is not passed to the widget with this function, it is applied while drawing.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setInheritedOpacity(float opacity);
 
@@ -456,7 +512,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the opacity of the widget that is multiplied with the opacity set in the renderer
         ///
-        /// @return Opacity of the widget
+        /// @return Opacity of the widget, multiplied with the opacity of its parents
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         float getInheritedOpacity() const;
 
@@ -477,6 +533,39 @@ namespace tgui
         Widget::Ptr getToolTip() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widget is drawn to an off-screen texture that is reused until the widget changes
+        ///
+        /// @param cached  Should the widget (and its children when it is a container) be drawn to a cached bitmap?
+        ///
+        /// This is useful for containers with many widgets that rarely change. The bitmap is redrawn when the widget or one
+        /// of its children is resized, shown or hidden, enabled or disabled, focused or unfocused, changes its contents (e.g.
+        /// the text of a label), gets a different renderer property, receives an event or when widgets are added to or removed
+        /// from it. Moving the widget doesn't require a redraw. Changes that aren't made through the widget functions require
+        /// a call to invalidateCachedBitmap or Gui::requestRedraw.
+        ///
+        /// Caching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCachedAsBitmap(bool cached);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widget is drawn to an off-screen texture that is reused until the widget changes
+        ///
+        /// @return Is the widget cached as a bitmap?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCachedAsBitmap() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forces the cached bitmap of this widget and of all its parents to be redrawn the next time they are drawn
+        ///
+        /// Call this function after making a change that isn't detected automatically (see setCachedAsBitmap).
+        /// The gui to which the widget was added will also report that it needs to be redrawn (see Gui::isRedrawNeeded).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateCachedBitmap();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the widget can gain focus
         /// @return Can the widget be focused?
@@ -502,6 +591,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called every frame with the time passed since the last frame.
+        ///
+        /// When the widget is inside a gui, the gui only calls this function while the widget needs it (see setUpdateNeeded).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime);
 
@@ -690,6 +781,25 @@ namespace tgui
         virtual void rendererChanged(const std::string& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when a texture that was still being loaded in the background has finished loading
+        ///
+        /// @param property  Lowercase name of the renderer property containing the texture, or the name that was passed to
+        ///                  waitForTexture
+        ///
+        /// By default, rendererChanged is called again for the property, so that the widget uses the real size of the image.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void textureLoaded(const std::string& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls textureLoaded once the texture has finished loading, when it is still being loaded in the background
+        ///
+        /// Textures in the renderer of the widget are waited for automatically, this is only needed for other textures.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForTexture(const Texture& texture, const std::string& property);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -723,6 +833,62 @@ namespace tgui
                                 Color color) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draw a triangle with the given color, without creating a shape. The opacity is not applied to the color.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawTriangle(sf::RenderTarget& target,
+                          const sf::RenderStates& states,
+                          Vector2f point1,
+                          Vector2f point2,
+                          Vector2f point3,
+                          Color color) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the widget via its cached bitmap, the bitmap is first redrawn when it is outdated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCachedBitmap(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts an animation, after finishing the animation that was changing the same property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addAnimation(std::shared_ptr<priv::Animation> animation);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Advances the animations of the widget. This is done by the gui, or by the update function when the widget isn't
+        // part of a gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAnimations(sf::Time elapsedTime);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Lets the gui know that the widget will look different after the given time, without it being changed (e.g. when the
+        // caret will blink). This has to be called again from the update function each time the widget is updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleRedraw(sf::Time delay) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Lets the gui call the update function of the widget every frame (e.g. to blink the caret or to let a double click
+        // expire). The gui no longer visits the widget after the update function calls this function again with false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setUpdateNeeded(bool updateNeeded);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the container of the gui to which the widget was added, or a nullptr when the widget isn't part of a gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GuiContainer* findGuiContainer() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the memory held by the widget to the report. Widgets that store texts or other widgets override this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void reportMemoryUsage(MemoryUsage& usage) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw the borders around the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -742,6 +908,44 @@ namespace tgui
         void rendererChangedCallback(const std::string& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Waits for the textures that are still being loaded in a renderer property (or in the renderer of a child widget,
+        // e.g. the close button of a child window)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForTexturesInProperty(const std::string& property, ObjectConverter& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Lets the texture call textureLoaded on this widget once it has finished loading
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForTextureData(const std::shared_ptr<TextureData>& data, const std::string& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Waits for the same textures as another widget, after the widget was copied or moved
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForTexturesOf(const Widget& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the callbacks that this widget added to the textures that are still being loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopWaitingForTextures();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the animation scheduler of the gui to which the widget belongs, or a nullptr when the widget isn't in a gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        priv::AnimationScheduler* findAnimationScheduler() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Lets the scheduler advance the animations and call the update function of this widget and its children when needed,
+        // after the widget was added to a parent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleAnimations(priv::AnimationScheduler* scheduler);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -768,8 +972,8 @@ namespace tgui
         Vector2f m_prevSize;
 
         // Layouts that need to recalculate their value when the position or size of this widget changes
-        std::unordered_set<Layout*> m_boundPositionLayouts;
-        std::unordered_set<Layout*> m_boundSizeLayouts;
+        std::unordered_set<Layout*, std::hash<Layout*>, std::equal_to<Layout*>, PoolAllocator<Layout*>> m_boundPositionLayouts;
+        std::unordered_set<Layout*, std::hash<Layout*>, std::equal_to<Layout*>, PoolAllocator<Layout*>> m_boundSizeLayouts;
 
         // When a widget is disabled, it will no longer receive events
         bool m_enabled = true;
@@ -805,6 +1009,16 @@ namespace tgui
         // Show animations
         std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
 
+        // The gui that advances the animations of the widget, or nullptr when they are advanced by the update function
+        priv::AnimationScheduler* m_animationScheduler = nullptr;
+
+        // Does the gui have to call the update function of the widget every frame?
+        bool m_updateNeeded = false;
+
+        // Textures that were still being loaded in the background when the widget started using them, together with the
+        // property that is passed to textureLoaded once they are loaded
+        std::vector<std::pair<std::weak_ptr<TextureData>, std::string>> m_loadingTextures;
+
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
         float m_inheritedOpacity = 1;
@@ -814,6 +1028,11 @@ namespace tgui
         float m_opacityCached = 1;
         bool m_transparentTextureCached = false;
 
+        // Off-screen texture in which the widget is drawn when it is cached as bitmap
+        bool m_cachedAsBitmap = false;
+        mutable bool m_cachedBitmapOutdated = true;
+        mutable std::unique_ptr<sf::RenderTexture> m_cachedBitmap;
+
     #ifdef TGUI_USE_CPP17
         std::any m_userData;
     #else
@@ -822,10 +1041,17 @@ namespace tgui
 
         std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
 
+        // Counters that let Gui know when its cached focus path and tab order are outdated. The first one changes whenever
+        // the focus changes, the second one when widgets are added, removed, reordered, shown, hidden, enabled or disabled.
+        static unsigned int m_focusChangeCounter;
+        static unsigned int m_focusableWidgetsChangeCounter;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, drawCachedBitmap, save and load
+        friend class MemoryUsage; // MemoryUsage calls reportMemoryUsage
+        friend class priv::AnimationScheduler; // The scheduler updates the widgets and keeps m_animationScheduler up-to-date
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,12 +140,18 @@ namespace tgui
         void updateSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when the image (or a texture of the renderer) finished loading in the background
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textureLoaded(const std::string& property) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<BitmapButton>(*this);
+            return makePooled<BitmapButton>(*this);
         }
 
 
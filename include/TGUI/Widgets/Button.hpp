@@ -263,7 +263,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Button>(*this);
+            return makePooled<Button>(*this);
         }
 
 
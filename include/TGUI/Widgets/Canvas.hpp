@@ -191,7 +191,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Canvas>(*this);
+            return makePooled<Canvas>(*this);
         }
 
 
@@ -382,6 +382,12 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the memory of the lines and the scrollbar to the report
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reportMemoryUsage(MemoryUsage& usage) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,7 +411,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<ChatBox>(*this);
+            return makePooled<ChatBox>(*this);
         }
 
 
@@ -149,7 +149,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<CheckBox>(*this);
+            return makePooled<CheckBox>(*this);
         }
 
 
@@ -431,7 +431,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<ChildWindow>(*this);
+            return makePooled<ChildWindow>(*this);
         }
 
 
@@ -120,7 +120,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<ClickableWidget>(*this);
+            return makePooled<ClickableWidget>(*this);
         }
 
 
@@ -543,6 +543,12 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the memory of the text and the list box to the report
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reportMemoryUsage(MemoryUsage& usage) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -590,7 +596,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<ComboBox>(*this);
+            return makePooled<ComboBox>(*this);
         }
 
 
@@ -30,7 +30,7 @@
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Text.hpp>
-#include <regex>
+#include <TGUI/InputValidator.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -371,6 +371,9 @@ namespace tgui
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// The regex is compiled only once (see the InputValidator class), so that typing a character only has to check the
+        /// characters behind the caret.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -462,6 +465,12 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the memory of the text and the cached character positions to the report
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reportMemoryUsage(MemoryUsage& usage) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -498,6 +507,33 @@ namespace tgui
         std::size_t findCaretPosition(float posX);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the horizontal offset of the caret when placed in front of the character at the given index of the displayed
+        // text. The offsets are cached, only the ones that were invalidated since the last call are recalculated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getCharacterPosition(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the cached character offsets and validator states as outdated starting from the given index.
+        // This has to be called after each change to the displayed text or to the properties that influence its width.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateCharacterPositions(std::size_t firstChangedIndex = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the outdated character offsets up to and including the given index.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCharacterPositions(std::size_t lastIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the state of the input validator after the given amount of characters of the text.
+        // Only states that were invalidated since the last call are recalculated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InputValidator::State getValidatorState(std::size_t index);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Removes the selected characters. This function is called when pressing backspace, delete or a letter while there were
         // some characters selected.
@@ -534,7 +570,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<EditBox>(*this);
+            return makePooled<EditBox>(*this);
         }
 
 
@@ -561,8 +597,7 @@ namespace tgui
         // The text inside the edit box
         sf::String    m_text;
 
-        std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        InputValidator m_inputValidator;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
@@ -594,6 +629,16 @@ namespace tgui
         // Is there a possibility that the user is going to double click?
         bool m_possibleDoubleClick = false;
 
+        // The horizontal offset in front of every character of the displayed text (and one more for behind the last character).
+        // Only the first m_validCharPositions values are up-to-date, the rest is recalculated when needed.
+        std::vector<float> m_charPositions = {0};
+        std::size_t        m_validCharPositions = 1;
+
+        // The state of the input validator after every character of the text (and one more for the empty text before it).
+        // Only the first m_validValidatorStates values are up-to-date, the rest is recalculated when needed.
+        std::vector<InputValidator::State> m_validatorStates = {0};
+        std::size_t                        m_validValidatorStates = 1;
+
         // We need three texts for drawing + one for the default text + one more for calculations.
         Text m_textBeforeSelection;
         Text m_textSelection;
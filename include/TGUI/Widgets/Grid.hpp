@@ -362,7 +362,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Grid>(*this);
+            return makePooled<Grid>(*this);
         }
 
 
@@ -157,7 +157,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Group>(*this);
+            return makePooled<Group>(*this);
         }
 
 
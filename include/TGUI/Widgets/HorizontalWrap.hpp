@@ -83,7 +83,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<HorizontalWrap>(*this);
+            return makePooled<HorizontalWrap>(*this);
         }
 
 
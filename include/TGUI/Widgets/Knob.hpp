@@ -29,6 +29,7 @@
 
 #include <TGUI/Widget.hpp>
 #include <TGUI/Renderers/KnobRenderer.hpp>
+#include <TGUI/CircleShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -327,7 +328,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Knob>(*this);
+            return makePooled<Knob>(*this);
         }
 
 
@@ -353,6 +354,11 @@ namespace tgui
         Sprite m_spriteBackground;
         Sprite m_spriteForeground;
 
+        // The geometry of the circles is only recalculated when their size or the amount of borders changes
+        mutable CircleShape m_bordersShape;
+        mutable CircleShape m_backgroundShape;
+        mutable CircleShape m_thumbShape;
+
         // Cached renderer properties
         Borders m_bordersCached;
         Color   m_borderColorCached;
@@ -336,6 +336,12 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the memory of the text and its lines to the report
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reportMemoryUsage(MemoryUsage& usage) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -360,12 +366,18 @@ namespace tgui
         void rearrangeText();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text in lines that fit within the given width, reusing the existing line objects where possible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLines(float maxWidth);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Label>(*this);
+            return makePooled<Label>(*this);
         }
 
 
@@ -381,6 +393,11 @@ namespace tgui
         sf::String m_string;
         std::vector<Text> m_lines;
 
+        // The lines are only recreated when the text, font, text size or style changed or when they have to fit in a different
+        // width. The objects in m_lines are reused when the text changes, so that no new texts have to be constructed.
+        bool  m_linesOutdated = true;
+        float m_linesMaxWidth = 0;
+
         unsigned int m_textSize = 0;
         HorizontalAlignment m_horizontalAlignment = HorizontalAlignment::Left;
         VerticalAlignment m_verticalAlignment = VerticalAlignment::Top;
@@ -284,10 +284,43 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void mouseNoLongerDown() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParent(Container* parent) override;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Widget that is placed in the popup layer of the gui to show the open menu on top of the other widgets
+        class MenuPopup;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Opens the menu and shows it in the popup layer when the menu bar is part of a gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void openMenu(std::size_t menuIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the open menu is drawn by a popup instead of by the menu bar itself
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMenuShownInPopup() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area covered by the items of the open menu, relative to the position of the menu bar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getOpenMenuRect() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the items of the open menu. The states have to be translated to the position of the menu bar.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawOpenMenu(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when the mouse leaves the widget. If requested, a callback will be send.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -345,7 +378,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<MenuBar>(*this);
+            return makePooled<MenuBar>(*this);
         }
 
 
@@ -225,7 +225,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<MessageBox>(*this);
+            return makePooled<MessageBox>(*this);
         }
 
 
@@ -176,7 +176,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Panel>(*this);
+            return makePooled<Panel>(*this);
         }
 
 
@@ -230,7 +230,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Picture>(*this);
+            return makePooled<Picture>(*this);
         }
 
 
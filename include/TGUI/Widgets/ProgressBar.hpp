@@ -322,7 +322,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<ProgressBar>(*this);
+            return makePooled<ProgressBar>(*this);
         }
 
 
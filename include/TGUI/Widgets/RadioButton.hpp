@@ -30,6 +30,7 @@
 #include <TGUI/Renderers/RadioButtonRenderer.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/CircleShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -312,7 +313,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<RadioButton>(*this);
+            return makePooled<RadioButton>(*this);
         }
 
 
@@ -335,6 +336,11 @@ namespace tgui
         // This will contain the text that is written next to radio button.
         Text m_text;
 
+        // The geometry of the circles is only recalculated when the size of the radio button changes
+        mutable CircleShape m_bordersShape;
+        mutable CircleShape m_backgroundShape;
+        mutable CircleShape m_checkShape;
+
         // This will store the size of the text ( 0 to auto size )
         unsigned int m_textSize = 0;
 
@@ -89,7 +89,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<RadioButtonGroup>(*this);
+            return makePooled<RadioButtonGroup>(*this);
         }
 
 
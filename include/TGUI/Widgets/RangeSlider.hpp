@@ -324,7 +324,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<RangeSlider>(*this);
+            return makePooled<RangeSlider>(*this);
         }
 
 
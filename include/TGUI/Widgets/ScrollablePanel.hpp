@@ -319,7 +319,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<ScrollablePanel>(*this);
+            return makePooled<ScrollablePanel>(*this);
         }
 
 
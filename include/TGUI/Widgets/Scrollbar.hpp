@@ -306,7 +306,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Scrollbar>(*this);
+            return makePooled<Scrollbar>(*this);
         }
 
 
@@ -416,6 +416,22 @@ namespace tgui
         bool isShown() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes a mouse move event to the scrollbar
+        /// @return Does the scrollbar look different now (e.g. because the mouse is hovering over a different part of it)?
+        ///
+        /// The scrollbar isn't part of a container, so the widget containing it has to redraw its cached bitmap when needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mouseMovedOnScrollbar(Vector2f pos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the scrollbar that the mouse is no longer on top of it
+        /// @return Was the mouse previously on top of the scrollbar, i.e. does the scrollbar look different now?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mouseNoLongerOnScrollbar();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -328,7 +328,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Slider>(*this);
+            return makePooled<Slider>(*this);
         }
 
 
@@ -258,7 +258,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<SpinButton>(*this);
+            return makePooled<SpinButton>(*this);
         }
 
 
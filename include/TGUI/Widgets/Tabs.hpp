@@ -475,7 +475,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<Tabs>(*this);
+            return makePooled<Tabs>(*this);
         }
 
 
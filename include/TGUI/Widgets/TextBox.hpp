@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -128,6 +129,9 @@ namespace tgui
         ///
         /// @return  The text that is currently inside the text box
         ///
+        /// The text box stores its text per line, the string returned here is only assembled when the text changed since the
+        /// last call. Calling this function after every edit on a very large text is thus relatively expensive.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const sf::String& getText() const;
 
@@ -335,6 +339,28 @@ namespace tgui
         sf::Vector2<std::size_t> findCaretPosition(Vector2f position) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the horizontal offset in front of every character on the given line (and one more for behind the last character).
+        // The offsets are calculated the first time a line is accessed and cached until the line changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<float>& getLineCharacterPositions(std::size_t lineNumber) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the vertices of the characters on the given line relative to the top of the line, six per character
+        // (whitespace gets an empty quad).
+        // The vertices are only built when a line is first drawn and are cached until the line changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<sf::Vertex>& getLineVertices(std::size_t lineNumber) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills m_visibleVertices with the vertices of the lines in the range [firstLine, lastLine) and changes the color
+        // of the selected characters. Nothing happens when the range and the selection didn't change since the last call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleVertices(std::size_t firstLine, std::size_t lastLine) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Converts the two dimensional selection positions into one dimensional positions in the text.
         // The first element of the pair is the selection start and the second one is the selection end.
@@ -342,6 +368,56 @@ namespace tgui
         std::pair<std::size_t, std::size_t> findTextSelectionPositions() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts a position in the text to a line and a position on that line. A position at the end of a line that was split
+        // by word wrap is placed behind the last character of that line instead of in front of the first character of the next.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2<std::size_t> findLinePosition(std::size_t textPosition) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether a newline character follows the line in the text (as opposed to the line being split by word wrap)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool lineEndsWithNewline(std::size_t lineNumber) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of characters in the text, without having to build the entire string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getTextLength() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the part of the text that is stored in the lines in the range [firstLine, lastLine)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getLinesText(std::size_t firstLine, std::size_t lastLine) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns a part of the text, without having to build the entire string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getTextPart(std::size_t position, std::size_t count) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces count characters starting at the given position with another text and places the caret behind the inserted
+        // text. Only the paragraphs that contain the replaced characters are word wrapped again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceText(std::size_t position, std::size_t count, const sf::String& insertion);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word wraps the text and adds the resulting lines to the vectors. The start of each line is stored relative to textOffset.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wrapText(const sf::String& text, std::size_t textOffset, std::vector<sf::String>& lines, std::vector<std::size_t>& lineStarts) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the scrollbar how high the text is. Returns true when the scrollbar appeared or disappeared because of it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateScrollbarMaximum();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when you are selecting text.
         // It will find out which part of the text is selected.
@@ -363,7 +439,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Called when the selection changes. Scrolls the caret into view and marks the visible vertices for recoloring.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
@@ -426,6 +502,12 @@ namespace tgui
         void rendererChanged(const std::string& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the memory of the text, its lines and the scrollbar to the report
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reportMemoryUsage(MemoryUsage& usage) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -443,7 +525,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<TextBox>(*this);
+            return makePooled<TextBox>(*this);
         }
 
 
@@ -456,11 +538,20 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        sf::String   m_text;
         unsigned int m_textSize = 18;
         unsigned int m_lineHeight = 24;
 
-        std::vector<sf::String> m_lines;
+        // The text is stored as word wrapped lines, together with the position in the text at which each line starts.
+        // When the next line starts one character further than where a line ends, then that character is a newline.
+        std::vector<sf::String> m_lines{""};
+        std::vector<std::size_t> m_lineStarts{0};
+
+        // The entire text as a single string, which is only rebuilt from the lines when getText is called after a change
+        mutable sf::String m_text;
+        mutable bool m_textCached = true;
+
+        // Cached horizontal offsets of the characters on each line, an empty vector means that it wasn't calculated yet
+        mutable std::vector<std::vector<float>> m_lineCharPositions;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
@@ -477,11 +568,14 @@ namespace tgui
         Vector2f m_caretPosition;
         bool m_caretVisible = true;
 
-        Text m_textBeforeSelection;
-        Text m_textSelection1;
-        Text m_textSelection2;
-        Text m_textAfterSelection1;
-        Text m_textAfterSelection2;
+        // Cached vertices of the characters on each line, an empty vector means that it wasn't built yet
+        mutable std::vector<std::vector<sf::Vertex>> m_lineVertices;
+
+        // Vertices of the lines that were drawn the last time, with the selected characters in the selected text color
+        mutable std::vector<sf::Vertex> m_visibleVertices;
+        mutable std::size_t m_visibleVerticesFirstLine = 0;
+        mutable std::size_t m_visibleVerticesLastLine = 0;
+        mutable bool m_visibleVerticesValid = false;
 
         std::vector<FloatRect> m_selectionRects;
 
@@ -500,6 +594,8 @@ namespace tgui
         Padding m_paddingCached;
         Color   m_borderColorCached;
         Color   m_backgroundColorCached;
+        Color   m_textColorCached;
+        Color   m_selectedTextColorCached;
         Color   m_caretColorCached;
         Color   m_selectedTextBackgroundColorCached;
         float   m_caretWidthCached = 1;
@@ -84,7 +84,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Widget::Ptr clone() const override
         {
-            return std::make_shared<VerticalLayout>(*this);
+            return makePooled<VerticalLayout>(*this);
         }
 
 
@@ -24,12 +24,53 @@
 
 
 #include <TGUI/Animation.hpp>
-#include <TGUI/Widget.hpp>
+#include <TGUI/Container.hpp>
+#include <TGUI/Profiler.hpp>
+#include <algorithm>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    float applyEasing(EasingType easing, float progress)
+    {
+        switch (easing)
+        {
+            case EasingType::Linear:
+                return progress;
+
+            case EasingType::EaseIn:
+                return progress * progress * progress;
+
+            case EasingType::EaseOut:
+            {
+                const float inverse = 1 - progress;
+                return 1 - (inverse * inverse * inverse);
+            }
+
+            case EasingType::EaseInOut:
+            {
+                if (progress < 0.5f)
+                    return 4 * progress * progress * progress;
+
+                const float inverse = 2 - (2 * progress);
+                return 1 - (inverse * inverse * inverse / 2);
+            }
+
+            case EasingType::EaseOutBack:
+            {
+                const float overshoot = 1.70158f;
+                const float t = progress - 1;
+                return 1 + ((overshoot + 1) * t * t * t) + (overshoot * t * t);
+            }
+        }
+
+        return progress;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     namespace priv
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,18 +90,33 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        Animation::Animation(Type type, Widget::Ptr widget, sf::Time duration, std::function<void()> finishedCallback) :
+        bool Animation::changesSameProperty(const Animation& other) const
+        {
+            return m_type == other.m_type;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Animation::Animation(Type type, Widget::Ptr widget, sf::Time duration, std::function<void()> finishedCallback, EasingType easing) :
             m_type            {type},
             m_widget          {widget},
             m_totalDuration   {duration},
-            m_finishedCallback{finishedCallback}
+            m_finishedCallback{finishedCallback},
+            m_easing          {easing}
         {
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        MoveAnimation::MoveAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation {Type::Move, widget, duration, finishedCallback},
+        float Animation::getProgress() const
+        {
+            return applyEasing(m_easing, m_elapsedTime.asSeconds() / m_totalDuration.asSeconds());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        MoveAnimation::MoveAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback, EasingType easing) :
+            Animation {Type::Move, widget, duration, finishedCallback, easing},
             m_startPos{start},
             m_endPos  {end}
         {
@@ -77,7 +133,7 @@ namespace tgui
                 return true;
             }
 
-            m_widget->setPosition(m_startPos + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endPos - m_startPos)));
+            m_widget->setPosition(m_startPos + (getProgress() * (m_endPos - m_startPos)));
             return false;
         }
 
@@ -91,8 +147,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        ResizeAnimation::ResizeAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation  {Type::Resize, widget, duration, finishedCallback},
+        ResizeAnimation::ResizeAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback, EasingType easing) :
+            Animation  {Type::Resize, widget, duration, finishedCallback, easing},
             m_startSize{start},
             m_endSize  {end}
         {
@@ -109,7 +165,7 @@ namespace tgui
                 return true;
             }
 
-            m_widget->setSize(m_startSize + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endSize - m_startSize)));
+            m_widget->setSize(m_startSize + (getProgress() * (m_endSize - m_startSize)));
             return false;
         }
 
@@ -123,8 +179,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        FadeAnimation::FadeAnimation(Widget::Ptr widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation     {Type::Fade, widget, duration, finishedCallback},
+        FadeAnimation::FadeAnimation(Widget::Ptr widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback, EasingType easing) :
+            Animation     {Type::Fade, widget, duration, finishedCallback, easing},
             m_startOpacity{std::max(0.f, std::min(1.f, start))},
             m_endOpacity  {std::max(0.f, std::min(1.f, end))}
         {
@@ -141,7 +197,7 @@ namespace tgui
                 return true;
             }
 
-            m_widget->setInheritedOpacity(m_startOpacity + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endOpacity - m_startOpacity)));
+            m_widget->setInheritedOpacity(m_startOpacity + (getProgress() * (m_endOpacity - m_startOpacity)));
             return false;
         }
 
@@ -154,6 +210,226 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ColorAnimation::ColorAnimation(Widget::Ptr widget, std::string property, Color start, Color end, sf::Time duration, std::function<void()> finishedCallback, EasingType easing) :
+            Animation   {Type::Color, widget, duration, finishedCallback, easing},
+            m_property  {std::move(property)},
+            m_startColor{start},
+            m_endColor  {end}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool ColorAnimation::update(sf::Time elapsedTime)
+        {
+            m_elapsedTime += elapsedTime;
+            if (m_elapsedTime >= m_totalDuration)
+            {
+                finish();
+                return true;
+            }
+
+            // The easing curve may overshoot, so the components have to be clamped
+            const float progress = getProgress();
+            const auto interpolate = [progress](std::uint8_t start, std::uint8_t end){
+                const float value = start + (progress * (static_cast<float>(end) - start));
+                return static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, std::round(value))));
+            };
+
+            m_widget->getRenderer()->setProperty(m_property, Color{interpolate(m_startColor.getRed(), m_endColor.getRed()),
+                                                                   interpolate(m_startColor.getGreen(), m_endColor.getGreen()),
+                                                                   interpolate(m_startColor.getBlue(), m_endColor.getBlue()),
+                                                                   interpolate(m_startColor.getAlpha(), m_endColor.getAlpha())});
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void ColorAnimation::finish()
+        {
+            m_widget->getRenderer()->setProperty(m_property, m_endColor);
+            Animation::finish();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool ColorAnimation::changesSameProperty(const Animation& other) const
+        {
+            if (other.getType() != Type::Color)
+                return false;
+
+            return static_cast<const ColorAnimation&>(other).m_property == m_property;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        AnimationScheduler::AnimationScheduler(const Container* root) :
+            m_root{root}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        AnimationScheduler::~AnimationScheduler()
+        {
+            // The widgets may outlive the gui, in which case they have to advance their animations themselves again
+            for (const auto& widget : m_widgets)
+            {
+                if (widget->m_animationScheduler == this)
+                    widget->m_animationScheduler = nullptr;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationScheduler::add(const Widget::Ptr& widget)
+        {
+            if (widget->m_animationScheduler == this)
+                return;
+
+            if (widget->m_animationScheduler)
+                widget->m_animationScheduler->remove(widget.get());
+
+            widget->m_animationScheduler = this;
+            m_widgets.push_back(widget);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationScheduler::remove(Widget* widget)
+        {
+            const auto it = std::find_if(m_widgets.begin(), m_widgets.end(), [widget](const Widget::Ptr& w){ return w.get() == widget; });
+            if (it != m_widgets.end())
+                m_widgets.erase(it);
+
+            // The widget may also be in the list that is being processed by the update function
+            if (widget->m_animationScheduler == this)
+                widget->m_animationScheduler = nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationScheduler::addUpdatedWidget(const Widget::Ptr& widget)
+        {
+            if (std::find(m_updatedWidgets.begin(), m_updatedWidgets.end(), widget) == m_updatedWidgets.end())
+                m_updatedWidgets.push_back(widget);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationScheduler::update(sf::Time elapsedTime)
+        {
+            updateWidgets(elapsedTime);
+
+            if (m_widgets.empty())
+                return;
+
+            // Widgets that start animating during this function (e.g. from a callback) are added to m_widgets again
+            std::vector<Widget::Ptr> widgets;
+            widgets.swap(m_widgets);
+
+            std::vector<Widget::Ptr> animatingWidgets;
+            animatingWidgets.reserve(widgets.size());
+            for (auto& widget : widgets)
+            {
+                // Skip widgets that were removed by a callback of another animation
+                if (widget->m_animationScheduler != this)
+                    continue;
+
+                // Only a widget that is removed from its parent is removed from the scheduler immediately. When the parent
+                // itself was removed, we only find out here that the widget no longer belongs to the gui.
+                bool visible = true;
+                const Widget* ancestor = widget.get();
+                while (ancestor->getParent())
+                {
+                    visible = visible && ancestor->isVisible();
+                    ancestor = ancestor->getParent();
+                }
+
+                if (ancestor != m_root)
+                {
+                    widget->m_animationScheduler = nullptr;
+                    continue;
+                }
+
+                if (visible)
+                    widget->updateAnimations(elapsedTime);
+
+                if (widget->m_animationScheduler != this)
+                    continue;
+
+                if (widget->m_showAnimations.empty())
+                    widget->m_animationScheduler = nullptr;
+                else if (std::find(m_widgets.begin(), m_widgets.end(), widget) == m_widgets.end())
+                    animatingWidgets.push_back(std::move(widget));
+            }
+
+            m_widgets.insert(m_widgets.begin(), std::make_move_iterator(animatingWidgets.begin()), std::make_move_iterator(animatingWidgets.end()));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void AnimationScheduler::updateWidgets(sf::Time elapsedTime)
+        {
+            if (m_updatedWidgets.empty())
+                return;
+
+            // Widgets that need to be updated because of this function (e.g. from a callback) are added to m_updatedWidgets again
+            std::vector<Widget::Ptr> widgets;
+            widgets.swap(m_updatedWidgets);
+
+            std::vector<Widget::Ptr> updatedWidgets;
+            updatedWidgets.reserve(widgets.size());
+            for (auto& widget : widgets)
+            {
+                if (!widget->m_updateNeeded)
+                    continue;
+
+                // Widgets that left the gui are added again when they are added to a gui while they still need to be updated
+                bool visible = true;
+                const Widget* ancestor = widget.get();
+                while (ancestor->getParent())
+                {
+                    visible = visible && ancestor->isVisible();
+                    ancestor = ancestor->getParent();
+                }
+
+                if (ancestor != m_root)
+                    continue;
+
+                if (visible)
+                {
+                    TGUI_PROFILE_SCOPE(Update, widget.get());
+                    widget->update(elapsedTime);
+                }
+
+                if (widget->m_updateNeeded && (std::find(m_updatedWidgets.begin(), m_updatedWidgets.end(), widget) == m_updatedWidgets.end()))
+                    updatedWidgets.push_back(std::move(widget));
+            }
+
+            m_updatedWidgets.insert(m_updatedWidgets.begin(), std::make_move_iterator(updatedWidgets.begin()), std::make_move_iterator(updatedWidgets.end()));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool AnimationScheduler::isAnimating() const
+        {
+            // The animations of hidden widgets are paused, so they won't change the gui until the widget is shown again
+            for (const auto& widget : m_widgets)
+            {
+                bool visible = true;
+                for (const Widget* ancestor = widget.get(); ancestor->getParent(); ancestor = ancestor->getParent())
+                    visible = visible && ancestor->isVisible();
+
+                if (visible)
+                    return true;
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
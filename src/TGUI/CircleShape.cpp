@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/CircleShape.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
+
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    const float pi = 3.14159265358979f;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CircleShape::CircleShape(float radius, std::size_t pointCount) :
+        m_radius    {radius},
+        m_pointCount{pointCount}
+    {
+        updateVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CircleShape::setRadius(float radius)
+    {
+        if (radius != m_radius)
+        {
+            m_radius = radius;
+            updateVertices();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float CircleShape::getRadius() const
+    {
+        return m_radius;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CircleShape::setPointCount(std::size_t pointCount)
+    {
+        if (pointCount != m_pointCount)
+        {
+            m_pointCount = pointCount;
+            updateVertices();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t CircleShape::getPointCount() const
+    {
+        return m_pointCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CircleShape::setFillColor(const sf::Color& color)
+    {
+        if (color != m_fillColor)
+        {
+            m_fillColor = color;
+            for (auto& vertex : m_fillVertices)
+                vertex.color = color;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& CircleShape::getFillColor() const
+    {
+        return m_fillColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CircleShape::setOutlineColor(const sf::Color& color)
+    {
+        if (color != m_outlineColor)
+        {
+            m_outlineColor = color;
+            for (auto& vertex : m_outlineVertices)
+                vertex.color = color;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Color& CircleShape::getOutlineColor() const
+    {
+        return m_outlineColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CircleShape::setOutlineThickness(float thickness)
+    {
+        if (thickness != m_outlineThickness)
+        {
+            m_outlineThickness = thickness;
+            updateVertices();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float CircleShape::getOutlineThickness() const
+    {
+        return m_outlineThickness;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CircleShape::draw(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        if (m_fillColor.a > 0)
+            priv::drawVertices(target, m_fillVertices.data(), m_fillVertices.size(), sf::PrimitiveType::TrianglesFan, states);
+
+        if (!m_outlineVertices.empty() && (m_outlineColor.a > 0))
+            priv::drawVertices(target, m_outlineVertices.data(), m_outlineVertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CircleShape::updateVertices()
+    {
+        if (m_pointCount < 3)
+        {
+            m_fillVertices.clear();
+            m_outlineVertices.clear();
+            return;
+        }
+
+        // The points are placed like sf::CircleShape does, starting at the top of the circle.
+        // The fill consists of the center, all points and the first point again to close the fan.
+        m_fillVertices.resize(m_pointCount + 2);
+        m_fillVertices[0] = sf::Vertex{{m_radius, m_radius}, m_fillColor};
+        for (std::size_t i = 0; i < m_pointCount; ++i)
+        {
+            const float angle = (i * 2 * pi / m_pointCount) - (pi / 2);
+            m_fillVertices[i + 1] = sf::Vertex{{m_radius + (std::cos(angle) * m_radius), m_radius + (std::sin(angle) * m_radius)}, m_fillColor};
+        }
+        m_fillVertices[m_pointCount + 1] = m_fillVertices[1];
+
+        if (m_outlineThickness == 0)
+        {
+            m_outlineVertices.clear();
+            return;
+        }
+
+        // The outer points of the outline lie further from the center (or closer to it for a negative thickness), at a distance
+        // that keeps the edges of the outline parallel to the edges of the circle, which is what sf::Shape does as well.
+        const float offset = m_outlineThickness / std::cos(pi / m_pointCount);
+        m_outlineVertices.resize((m_pointCount + 1) * 2);
+        for (std::size_t i = 0; i < m_pointCount; ++i)
+        {
+            const float angle = (i * 2 * pi / m_pointCount) - (pi / 2);
+            const sf::Vector2f point = m_fillVertices[i + 1].position;
+            m_outlineVertices[i * 2] = sf::Vertex{point, m_outlineColor};
+            m_outlineVertices[i * 2 + 1] = sf::Vertex{{point.x + (std::cos(angle) * offset), point.y + (std::sin(angle) * offset)}, m_outlineColor};
+        }
+        m_outlineVertices[m_pointCount * 2] = m_outlineVertices[0];
+        m_outlineVertices[m_pointCount * 2 + 1] = m_outlineVertices[1];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +39,8 @@ namespace tgui
         m_target {target},
         m_oldView{target.getView()}
     {
+        TGUI_PROFILE_CLIPPING();
+
         Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
         topLeft = Vector2f(states.transform.transformPoint(topLeft));
 
@@ -108,6 +111,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::View& Clipping::getGuiView()
+    {
+        return m_originalView;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
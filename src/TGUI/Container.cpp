@@ -25,6 +25,10 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/PopupLayer.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/MemoryUsage.hpp>
+#include <TGUI/DrawOpacity.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
@@ -178,6 +182,8 @@ namespace tgui
                 widget->setParent(this);
 
             right.m_widgets = {};
+            ++m_focusChangeCounter;
+            ++m_focusableWidgetsChangeCounter;
         }
 
         return *this;
@@ -196,8 +202,8 @@ namespace tgui
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
 
-        if (m_opacityCached < 1)
-            widgetPtr->setInheritedOpacity(m_opacityCached);
+        ++m_focusableWidgetsChangeCounter;
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,6 +248,7 @@ namespace tgui
                 if (widget == m_focusedWidget)
                 {
                     m_focusedWidget = nullptr;
+                    ++m_focusChangeCounter;
                     widget->setFocused(false);
                 }
 
@@ -249,6 +256,8 @@ namespace tgui
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                ++m_focusableWidgetsChangeCounter;
+                invalidateCachedBitmap();
                 return true;
             }
         }
@@ -268,6 +277,9 @@ namespace tgui
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
+        ++m_focusChangeCounter;
+        ++m_focusableWidgetsChangeCounter;
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -342,8 +354,20 @@ namespace tgui
 
     void Container::loadWidgetsFromStream(std::stringstream& stream)
     {
-        auto rootNode = DataIO::parse(stream);
+        loadWidgetsFromNodeTree(DataIO::parse(stream));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromStream(std::stringstream&& stream)
+    {
+        loadWidgetsFromStream(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode)
+    {
         removeAllWidgets(); // The existing widgets will be replaced by the ones that will be loaded
 
         if (rootNode->propertyValuePairs.size() != 0)
@@ -381,13 +405,6 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromStream(std::stringstream&& stream)
-    {
-        loadWidgetsFromStream(stream);
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     void Container::saveWidgetsToStream(std::stringstream& stream) const
     {
         auto node = std::make_unique<DataIO::Node>();
@@ -437,6 +454,8 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
             m_widgetNames.erase(m_widgetNames.begin() + i);
+            ++m_focusableWidgetsChangeCounter;
+            invalidateCachedBitmap();
             break;
         }
     }
@@ -460,6 +479,8 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
             m_widgetNames.erase(m_widgetNames.begin() + i + 1);
+            ++m_focusableWidgetsChangeCounter;
+            invalidateCachedBitmap();
             break;
         }
     }
@@ -568,6 +589,7 @@ namespace tgui
                 m_focusedWidget->setFocused(false);
 
             m_focusedWidget = child;
+            ++m_focusChangeCounter;
         }
 
         if (!isFocused())
@@ -713,12 +735,8 @@ namespace tgui
     {
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
-        {
-            for (std::size_t i = 0; i < m_widgets.size(); ++i)
-                m_widgets[i]->setInheritedOpacity(m_opacityCached);
-        }
-        else if (property == "font")
+        // The opacity isn't passed to the child widgets, it is applied to them while drawing (see drawWidgetContainer)
+        if (property == "font")
         {
             for (const auto& widget : m_widgets)
             {
@@ -778,7 +796,10 @@ namespace tgui
         {
             // Update the elapsed time in widgets that need it
             if (m_widgets[i]->isVisible())
+            {
+                TGUI_PROFILE_SCOPE(Update, m_widgets[i].get());
                 m_widgets[i]->update(elapsedTime);
+            }
         }
 
         m_animationTimeElapsed = {};
@@ -786,6 +807,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::outdateCachedBitmaps()
+    {
+        if (m_cachedAsBitmap)
+            m_cachedBitmapOutdated = true;
+
+        for (auto& widget : m_widgets)
+        {
+            if (auto container = std::dynamic_pointer_cast<Container>(widget))
+                container->outdateCachedBitmaps();
+            else if (widget->m_cachedAsBitmap)
+                widget->m_cachedBitmapOutdated = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -806,6 +843,7 @@ namespace tgui
                     // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
                     if (widget->m_draggableWidget || widget->isContainer())
                     {
+                        TGUI_PROFILE_SCOPE(Event, widget.get());
                         widget->mouseMoved(mousePos);
                         return true;
                     }
@@ -816,7 +854,9 @@ namespace tgui
             Widget::Ptr widget = mouseOnWhichWidget(mousePos);
             if (widget != nullptr)
             {
-                // Send the event to the widget
+                // Send the event to the widget. Mouse moves happen too often to redraw cached bitmaps for each of them,
+                // so widgets call invalidateCachedBitmap themselves when the mouse changes their looks.
+                TGUI_PROFILE_SCOPE(Event, widget.get());
                 widget->mouseMoved(mousePos);
                 return true;
             }
@@ -837,12 +877,16 @@ namespace tgui
             Widget::Ptr widget = mouseOnWhichWidget(mousePos);
             if (widget)
             {
+                TGUI_PROFILE_SCOPE(Event, widget.get());
+                widget->invalidateCachedBitmap();
+
                 // Unfocus the previously focused widget
                 if (m_focusedWidget && (m_focusedWidget != widget))
                     m_focusedWidget->setFocused(false);
 
                 // Focus the widget unless it is a container, in which case it will get focused when the event is handled by the bottom widget
                 m_focusedWidget = widget;
+                ++m_focusChangeCounter;
                 if (!widget->isContainer())
                     widget->setFocused(true);
 
@@ -864,6 +908,7 @@ namespace tgui
                     m_focusedWidget->setFocused(false);
 
                 m_focusedWidget = nullptr;
+                ++m_focusChangeCounter;
                 setFocused(true);
             }
 
@@ -883,7 +928,11 @@ namespace tgui
             // Check if the mouse is on top of a widget
             Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mousePos);
             if (widgetBelowMouse != nullptr)
+            {
+                TGUI_PROFILE_SCOPE(Event, widgetBelowMouse.get());
+                widgetBelowMouse->invalidateCachedBitmap();
                 widgetBelowMouse->leftMouseReleased(mousePos);
+            }
 
             // Tell all widgets that the mouse has gone up
             // But don't do this when leftMouseReleased was called on this container because
@@ -891,7 +940,12 @@ namespace tgui
             if (!m_handingMouseReleased)
             {
                 for (auto& widget : m_widgets)
+                {
+                    if (widget->m_mouseDown)
+                        widget->invalidateCachedBitmap();
+
                     widget->mouseNoLongerDown();
+                }
             }
 
             if (widgetBelowMouse != nullptr)
@@ -916,6 +970,8 @@ namespace tgui
                 #endif
 
                     // Tell the widget that the key was pressed
+                    TGUI_PROFILE_SCOPE(Event, m_focusedWidget.get());
+                    m_focusedWidget->invalidateCachedBitmap();
                     m_focusedWidget->keyPressed(event.key);
                     return true;
                 }
@@ -933,6 +989,8 @@ namespace tgui
                 // Tell the widget that the key was pressed
                 if (m_focusedWidget && m_focusedWidget->isFocused())
                 {
+                    TGUI_PROFILE_SCOPE(Event, m_focusedWidget.get());
+                    m_focusedWidget->invalidateCachedBitmap();
                     m_focusedWidget->textEntered(event.text.unicode);
                     return true;
                 }
@@ -947,7 +1005,11 @@ namespace tgui
             // Send the event to the widget below the mouse
             Widget::Ptr widget = mouseOnWhichWidget({static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
             if (widget != nullptr)
+            {
+                TGUI_PROFILE_SCOPE(Event, widget.get());
+                widget->invalidateCachedBitmap();
                 return widget->mouseWheelScrolled(event.mouseWheelScroll.delta, {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
+            }
 
             return false;
         }
@@ -976,7 +1038,10 @@ namespace tgui
 
         // If the mouse is on a different widget, tell the old widget that the mouse has left
         if (m_widgetBelowMouse && (widget != m_widgetBelowMouse))
+        {
+            m_widgetBelowMouse->invalidateCachedBitmap();
             m_widgetBelowMouse->mouseNoLongerOnWidget();
+        }
 
         m_widgetBelowMouse = widget;
         return widget;
@@ -986,12 +1051,42 @@ namespace tgui
 
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
+        // The opacity of the container is multiplied with the colors of its child widgets while they are being drawn,
+        // so that changing the opacity of the container (e.g. while fading it) doesn't require updating all its children.
+        const float drawOpacity = priv::getDrawOpacity();
+        if (drawOpacity * m_opacityCached <= 0)
+            return;
+
+        priv::setDrawOpacity(drawOpacity * m_opacityCached);
+
         // Draw all widgets when they are visible
         for (const auto& widget : m_widgets)
         {
-            if (widget->isVisible())
+            if (!widget->isVisible())
+                continue;
+
+            TGUI_PROFILE_SCOPE(Draw, widget.get());
+            if (widget->isCachedAsBitmap())
+                widget->drawCachedBitmap(*target, states);
+            else
                 widget->draw(*target, states);
         }
+
+        priv::setDrawOpacity(drawOpacity);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::reportMemoryUsage(MemoryUsage& usage) const
+    {
+        Widget::reportMemoryUsage(usage);
+
+        usage.addWidgetBytes(m_widgets.capacity() * sizeof(Widget::Ptr) + m_widgetNames.capacity() * sizeof(sf::String));
+        for (const auto& name : m_widgetNames)
+            usage.addString(name);
+
+        for (const auto& widget : m_widgets)
+            usage.addWidget(*widget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1026,6 +1121,7 @@ namespace tgui
             // Try to focus the first focusable widget in the container
             auto oldUnfocusedWidget = container->m_focusedWidget;
             container->m_focusedWidget = nullptr;
+            ++m_focusChangeCounter;
             bool childFocused = reverseWidgetOrder ? container->focusPreviousWidget() : container->focusNextWidget();
 
             if (oldUnfocusedWidget && (oldUnfocusedWidget != container->m_focusedWidget))
@@ -1042,6 +1138,7 @@ namespace tgui
             m_focusedWidget->setFocused(false);
 
         m_focusedWidget = widget;
+        ++m_focusChangeCounter;
         m_focusedWidget->setFocused(true);
         return true;
     }
@@ -1054,6 +1151,8 @@ namespace tgui
         m_type = "GuiContainer";
         m_focused = true;
         m_isolatedFocus = true;
+
+        m_popupLayer = std::make_shared<PopupLayer>(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1079,6 +1178,73 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    priv::AnimationScheduler& GuiContainer::getAnimationScheduler()
+    {
+        return m_animationScheduler;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::requestRedraw(sf::Time delay)
+    {
+        if (delay <= sf::Time::Zero)
+            m_redrawNeeded = true;
+        else
+            m_timeUntilNextChange = std::min(m_timeUntilNextChange, delay);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::shared_ptr<PopupLayer>& GuiContainer::getPopupLayer() const
+    {
+        return m_popupLayer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<sf::RenderTexture> GuiContainer::acquireRenderTexture(sf::Vector2u size)
+    {
+        // Take the smallest texture from the pool that is large enough
+        auto bestIt = m_renderTexturePool.end();
+        for (auto it = m_renderTexturePool.begin(); it != m_renderTexturePool.end(); ++it)
+        {
+            const sf::Vector2u textureSize = (*it)->getSize();
+            if ((textureSize.x < size.x) || (textureSize.y < size.y))
+                continue;
+
+            if ((bestIt == m_renderTexturePool.end())
+             || (textureSize.x * textureSize.y < (*bestIt)->getSize().x * (*bestIt)->getSize().y))
+                bestIt = it;
+        }
+
+        if (bestIt != m_renderTexturePool.end())
+        {
+            auto texture = std::move(*bestIt);
+            m_renderTexturePool.erase(bestIt);
+            return texture;
+        }
+
+        // The size is rounded up so that the texture can still be used when the widget grows a little bit
+        auto texture = std::make_unique<sf::RenderTexture>();
+        if (!texture->create(((size.x + 63) / 64) * 64, ((size.y + 63) / 64) * 64))
+            return nullptr;
+
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiContainer::releaseRenderTexture(std::unique_ptr<sf::RenderTexture>& texture)
+    {
+        const std::size_t maxPooledRenderTextures = 4;
+        if (texture && (m_renderTexturePool.size() < maxPooledRenderTextures))
+            m_renderTexturePool.push_back(std::move(texture));
+
+        texture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
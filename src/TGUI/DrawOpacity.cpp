@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/DrawOpacity.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        float drawOpacity = 1;
+
+        // Storage that is reused to fade the vertices that are drawn while the draw opacity is less than 1
+        std::vector<sf::Vertex> fadedVertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        void setDrawOpacity(float opacity)
+        {
+            drawOpacity = opacity;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float getDrawOpacity()
+        {
+            return drawOpacity;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::Color applyDrawOpacity(sf::Color color, const sf::BlendMode& blendMode)
+        {
+            // Colors that were already multiplied with their alpha (e.g. the cached bitmap of a widget) are faded completely
+            if (blendMode.colorSrcFactor == sf::BlendMode::One)
+            {
+                color.r = static_cast<sf::Uint8>(color.r * drawOpacity);
+                color.g = static_cast<sf::Uint8>(color.g * drawOpacity);
+                color.b = static_cast<sf::Uint8>(color.b * drawOpacity);
+            }
+
+            color.a = static_cast<sf::Uint8>(color.a * drawOpacity);
+            return color;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const sf::Vertex* fadeVertices(const sf::Vertex* vertices, std::size_t vertexCount, const sf::BlendMode& blendMode)
+        {
+            fadedVertices.assign(vertices, vertices + vertexCount);
+            for (auto& vertex : fadedVertices)
+                vertex.color = applyDrawOpacity(vertex.color, blendMode);
+
+            return fadedVertices.data();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const sf::Vertex* fadeShape(const sf::Shape& shape, const sf::BlendMode& blendMode)
+        {
+            const sf::Color color = applyDrawOpacity(shape.getFillColor(), blendMode);
+
+            fadedVertices.clear();
+            for (std::size_t i = 0; i < shape.getPointCount(); ++i)
+                fadedVertices.emplace_back(shape.getPoint(i), color);
+
+            return fadedVertices.data();
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
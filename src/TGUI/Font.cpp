@@ -25,14 +25,76 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/FontManager.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <cassert>
 #include <iostream>
 
+#ifdef TGUI_ENABLE_PROFILER
+    #include <cstring>
+    #include <map>
+    #include <unordered_set>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        const sf::Glyph& loadGlyph(sf::Font& font, std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+        {
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            return font.getGlyph(codePoint, characterSize, bold, outlineThickness);
+        #else
+            (void)outlineThickness;
+            return font.getGlyph(codePoint, characterSize, bold);
+        #endif
+        }
+
+    #ifdef TGUI_ENABLE_PROFILER
+        // sf::Font doesn't tell whether a glyph still had to be rendered, so the profiler remembers which glyphs were requested
+        struct RequestedGlyphs
+        {
+            std::weak_ptr<sf::Font> font;
+            std::map<unsigned int, std::unordered_set<std::uint64_t>> glyphsPerSize;
+        };
+
+        std::map<const sf::Font*, RequestedGlyphs> requestedGlyphs;
+
+        // Returns false when the glyph is requested from the font for the first time
+        bool markGlyphRequested(const std::shared_ptr<sf::Font>& font, std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+        {
+            auto it = requestedGlyphs.find(font.get());
+            if (it == requestedGlyphs.end())
+            {
+                // Forget about the fonts that no longer exist before adding a new one
+                for (auto oldIt = requestedGlyphs.begin(); oldIt != requestedGlyphs.end();)
+                {
+                    if (oldIt->second.font.expired())
+                        oldIt = requestedGlyphs.erase(oldIt);
+                    else
+                        ++oldIt;
+                }
+
+                it = requestedGlyphs.emplace(font.get(), RequestedGlyphs{font, {}}).first;
+            }
+            else if (it->second.font.lock() != font) // A destroyed font had the same address
+            {
+                it->second.font = font;
+                it->second.glyphsPerSize.clear();
+            }
+
+            // The glyph is identified in the same way as inside sf::Font
+            std::uint32_t outlineBits;
+            std::memcpy(&outlineBits, &outlineThickness, sizeof(outlineBits));
+            const std::uint64_t key = (static_cast<std::uint64_t>(outlineBits) << 32) | (static_cast<std::uint64_t>(bold ? 1 : 0) << 31) | codePoint;
+            return !it->second.glyphsPerSize[characterSize].insert(key).second;
+        }
+    #endif
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -64,16 +126,15 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const sf::Font& font) :
-        m_font{std::make_shared<sf::Font>(font)}
+        m_font{FontManager::getFontCopy(font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const void* data, std::size_t sizeInBytes) :
-        m_font{std::make_shared<sf::Font>()}
+        m_font{FontManager::getFontFromMemory(data, sizeInBytes)}
     {
-        m_font->loadFromMemory(data, sizeInBytes);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -181,12 +242,55 @@ namespace tgui
     {
         assert(m_font != nullptr);
 
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        return m_font->getGlyph(codePoint, characterSize, bold, outlineThickness);
-    #else
-        (void)outlineThickness;
-        return m_font->getGlyph(codePoint, characterSize, bold);
+    #ifdef TGUI_ENABLE_PROFILER
+        if (Profiler::isEnabled() && !markGlyphRequested(m_font, codePoint, characterSize, bold, outlineThickness))
+            TGUI_PROFILE_GLYPH_MISS();
     #endif
+
+        return loadGlyph(*m_font, codePoint, characterSize, bold, outlineThickness);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadGlyphs(const sf::String& characters, unsigned int characterSize, bool bold, float outlineThickness) const
+    {
+        if (!m_font)
+            return;
+
+        for (const std::uint32_t codePoint : characters)
+            preloadGlyphs(codePoint, codePoint, characterSize, bold, outlineThickness);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadGlyphs(std::uint32_t first, std::uint32_t last, unsigned int characterSize, bool bold, float outlineThickness) const
+    {
+        if (!m_font || (first > last))
+            return;
+
+        std::uint32_t codePoint = first;
+        while (true)
+        {
+            // Preloading doesn't count as a miss, but the profiler has to know about the glyphs to not count them later
+            loadGlyph(*m_font, codePoint, characterSize, bold, 0);
+        #ifdef TGUI_ENABLE_PROFILER
+            markGlyphRequested(m_font, codePoint, characterSize, bold, 0);
+        #endif
+
+            if (outlineThickness != 0)
+            {
+                loadGlyph(*m_font, codePoint, characterSize, bold, outlineThickness);
+            #ifdef TGUI_ENABLE_PROFILER
+                markGlyphRequested(m_font, codePoint, characterSize, bold, outlineThickness);
+            #endif
+            }
+
+            // Checking at the end of the loop, incrementing past last would overflow when it is the highest possible value
+            if (codePoint == last)
+                break;
+
+            ++codePoint;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,172 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/FontManager.hpp>
+#include <cstring>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::map<std::string, std::weak_ptr<sf::Font>> FontManager::m_fileFonts;
+    std::multimap<std::uint64_t, FontManager::MemoryFont> FontManager::m_memoryFonts;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // 64-bit FNV-1a hash of the data
+        std::uint64_t hashBytes(const void* data, std::size_t sizeInBytes)
+        {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+
+            std::uint64_t hash = 14695981039346656037ULL;
+            for (std::size_t i = 0; i < sizeInBytes; ++i)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ULL;
+            }
+
+            return hash;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> FontManager::getFontFromFile(const std::string& filename)
+    {
+        const auto it = m_fileFonts.find(filename);
+        if (it != m_fileFonts.end())
+        {
+            if (auto font = it->second.lock())
+                return font;
+        }
+
+        auto font = std::make_shared<sf::Font>();
+        if (!font->loadFromFile(filename))
+            return font;
+
+        removeUnusedFonts();
+        m_fileFonts[filename] = font;
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> FontManager::getFontFromMemory(const void* data, std::size_t sizeInBytes)
+    {
+        const std::uint64_t hash = hashBytes(data, sizeInBytes);
+        const auto range = m_memoryFonts.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second.size != sizeInBytes)
+                continue;
+
+            // The data of the existing font is only guaranteed to still exist while the font is alive
+            auto font = it->second.font.lock();
+            if (font && (std::memcmp(it->second.data, data, sizeInBytes) == 0))
+                return font;
+        }
+
+        // The font keeps its own copy of the data, as the buffer of the caller could be freed while the font is shared
+        auto fontWithData = std::make_shared<FontWithData>();
+        fontWithData->data.assign(static_cast<const unsigned char*>(data), static_cast<const unsigned char*>(data) + sizeInBytes);
+        std::shared_ptr<sf::Font> font{fontWithData, &fontWithData->font};
+        if (!font->loadFromMemory(fontWithData->data.data(), sizeInBytes))
+            return std::make_shared<sf::Font>();
+
+        removeUnusedFonts();
+        m_memoryFonts.emplace(hash, MemoryFont{font, fontWithData->data.data(), sizeInBytes});
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> FontManager::getFontCopy(const sf::Font& font)
+    {
+        for (const auto& pair : m_fileFonts)
+        {
+            auto loadedFont = pair.second.lock();
+            if (loadedFont.get() == &font)
+                return loadedFont;
+        }
+
+        for (const auto& pair : m_memoryFonts)
+        {
+            auto loadedFont = pair.second.font.lock();
+            if (loadedFont.get() == &font)
+                return loadedFont;
+        }
+
+        // A font that we didn't load could be destroyed at any time, so we have no choice but to copy it
+        return std::make_shared<sf::Font>(font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t FontManager::getFontCount()
+    {
+        std::size_t count = 0;
+        for (const auto& pair : m_fileFonts)
+        {
+            if (!pair.second.expired())
+                ++count;
+        }
+
+        for (const auto& pair : m_memoryFonts)
+        {
+            if (!pair.second.font.expired())
+                ++count;
+        }
+
+        return count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::removeUnusedFonts()
+    {
+        for (auto it = m_fileFonts.begin(); it != m_fileFonts.end();)
+        {
+            if (it->second.expired())
+                it = m_fileFonts.erase(it);
+            else
+                ++it;
+        }
+
+        for (auto it = m_memoryFonts.begin(); it != m_memoryFonts.end();)
+        {
+            if (it->second.font.expired())
+                it = m_memoryFonts.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/DefaultFont.hpp>
+#include <TGUI/FontManager.hpp>
 #include <functional>
 #include <sstream>
 #include <locale>
@@ -70,10 +71,7 @@ namespace tgui
     Font getGlobalFont()
     {
         if (!globalFont)
-        {
-            globalFont = std::make_shared<sf::Font>();
-            globalFont->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes));
-        }
+            globalFont = FontManager::getFontFromMemory(defaultFontBytes, sizeof(defaultFontBytes));
 
         return globalFont;
     }
@@ -25,7 +25,12 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/PopupLayer.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/MemoryUsage.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/DrawOpacity.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
 
@@ -138,6 +143,7 @@ namespace tgui
             m_view = view;
 
         Clipping::setGuiView(m_view);
+        m_container->requestRedraw();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -150,8 +156,227 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Gui::handleEvent(sf::Event event)
+    {
+        if (m_eventQueueEnabled)
+        {
+            queueEvent(event);
+            return false;
+        }
+
+        return processEvent(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setEventQueueEnabled(bool enabled)
+    {
+        if (m_eventQueueEnabled && !enabled)
+            handleQueuedEvents();
+
+        m_eventQueueEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isEventQueueEnabled() const
+    {
+        return m_eventQueueEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::handleQueuedEvents()
+    {
+        m_eventQueueStats.received = m_receivedEventCount;
+        m_eventQueueStats.merged = m_receivedEventCount - m_queuedEvents.size();
+        m_eventQueueStats.dispatched = m_queuedEvents.size();
+        m_receivedEventCount = 0;
+
+        // The events are moved to another list first, in case handling them causes new events to be queued.
+        // Both lists keep their capacity so that no memory has to be allocated in the next frames.
+        m_dispatchedEvents.swap(m_queuedEvents);
+
+        bool eventConsumed = false;
+        for (const auto& event : m_dispatchedEvents)
+        {
+            if (processEvent(event))
+                eventConsumed = true;
+        }
+
+        m_dispatchedEvents.clear();
+        return eventConsumed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Gui::EventQueueStats& Gui::getEventQueueStats() const
+    {
+        return m_eventQueueStats;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::queueEvent(const sf::Event& event)
+    {
+        ++m_receivedEventCount;
+
+        if (!m_queuedEvents.empty())
+        {
+            sf::Event& lastEvent = m_queuedEvents.back();
+            if ((event.type == sf::Event::MouseMoved) && (lastEvent.type == sf::Event::MouseMoved))
+            {
+                // Only the last position matters
+                lastEvent.mouseMove = event.mouseMove;
+                return;
+            }
+            else if ((event.type == sf::Event::MouseWheelScrolled) && (lastEvent.type == sf::Event::MouseWheelScrolled)
+                  && (event.mouseWheelScroll.wheel == lastEvent.mouseWheelScroll.wheel)
+                  && (event.mouseWheelScroll.x == lastEvent.mouseWheelScroll.x)
+                  && (event.mouseWheelScroll.y == lastEvent.mouseWheelScroll.y))
+            {
+                // Scrolling at the same position can be done at once
+                lastEvent.mouseWheelScroll.delta += event.mouseWheelScroll.delta;
+                return;
+            }
+            else if (event.type == sf::Event::TouchMoved)
+            {
+                // Touch moves of different fingers are independent, so the move can be merged with an earlier move of the
+                // same finger as long as only touch moves were queued after it.
+                for (auto it = m_queuedEvents.rbegin(); (it != m_queuedEvents.rend()) && (it->type == sf::Event::TouchMoved); ++it)
+                {
+                    if (it->touch.finger == event.touch.finger)
+                    {
+                        it->touch = event.touch;
+                        return;
+                    }
+                }
+            }
+        }
+
+        m_queuedEvents.push_back(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::updateFocusPath()
+    {
+        if (m_focusPathValid && (m_focusPathCounter == Container::m_focusChangeCounter))
+            return;
+
+        m_focusPathValid = true;
+        m_focusPathCounter = Container::m_focusChangeCounter;
+        m_tabOrderCurrent = nullptr;
+        m_tabOrderScope = m_container.get();
+        m_focusPathEndsInContainer = false;
+
+        Container* container = m_container.get();
+        while (container->m_focusedWidget)
+        {
+            Widget* child = container->m_focusedWidget.get();
+            if (!child->isContainer())
+            {
+                m_tabOrderCurrent = child;
+                return;
+            }
+
+            container = static_cast<Container*>(child);
+            if (container->m_isolatedFocus)
+                m_tabOrderScope = container;
+        }
+
+        m_focusPathEndsInContainer = (container != m_container.get());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::focusWidgetInTabOrder(bool reverse)
+    {
+        updateFocusPath();
+
+        // When the last focused widget is a container, the containers decide themselves where to continue
+        if (m_focusPathEndsInContainer)
+            return false;
+
+        if (!m_tabOrderValid || (m_tabOrderCounter != Container::m_focusableWidgetsChangeCounter) || (m_tabOrderBuiltScope != m_tabOrderScope))
+        {
+            m_tabOrderValid = true;
+            m_tabOrderCounter = Container::m_focusableWidgetsChangeCounter;
+            m_tabOrderBuiltScope = m_tabOrderScope;
+            m_tabOrder.clear();
+            m_tabOrderIndices.clear();
+            addToTabOrder(*m_tabOrderScope);
+        }
+
+        if (m_tabOrder.empty())
+            return true;
+
+        // When no widget is focused yet, start before the first or after the last widget
+        std::size_t index;
+        if (m_tabOrderCurrent)
+        {
+            const auto it = m_tabOrderIndices.find(m_tabOrderCurrent);
+            if (it == m_tabOrderIndices.end())
+                return false; // The widget was focused with the mouse but can't be focused with the tab key (e.g. a label)
+
+            index = it->second;
+        }
+        else
+            index = reverse ? 0 : m_tabOrder.size() - 1;
+
+        // The tab order wraps around because the scope is always a container that keeps the focus inside it
+        for (std::size_t i = 0; i < m_tabOrder.size(); ++i)
+        {
+            index = reverse ? (index + m_tabOrder.size() - 1) % m_tabOrder.size() : (index + 1) % m_tabOrder.size();
+
+            // Widgets like labels decide themselves whether they can be focused, so the tab order could be outdated
+            Widget* widget = m_tabOrder[index];
+            if (!widget->canGainFocus() || !widget->isVisible() || !widget->isEnabled())
+                continue;
+
+            if (widget == m_tabOrderCurrent)
+                return true;
+
+            // The previous widget is unfocused first when both are inside the same container, like Container::focusNextWidget does
+            if (m_tabOrderCurrent && (m_tabOrderCurrent->getParent() == widget->getParent()))
+                m_tabOrderCurrent->setFocused(false);
+
+            widget->setFocused(true);
+            return true;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::addToTabOrder(const Container& container)
+    {
+        for (const auto& widget : container.m_widgets)
+        {
+            if (!widget->canGainFocus() || !widget->isVisible() || !widget->isEnabled())
+                continue;
+
+            if (widget->isContainer())
+            {
+                // Isolated containers (e.g. ChildWindow) can't be entered with the tab key
+                const auto& childContainer = static_cast<const Container&>(*widget);
+                if (!childContainer.m_isolatedFocus)
+                    addToTabOrder(childContainer);
+            }
+            else
+            {
+                m_tabOrderIndices[widget.get()] = m_tabOrder.size();
+                m_tabOrder.push_back(widget.get());
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::processEvent(sf::Event event)
     {
         assert(m_target != nullptr);
+        TGUI_PROFILE_SCOPE(Event, nullptr);
 
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
@@ -205,11 +430,8 @@ namespace tgui
             // If a tooltip is visible then hide it now
             if (m_visibleToolTip != nullptr)
             {
-                // Correct the position of the tool tip so that it is relative again
-                m_visibleToolTip->setPosition(m_visibleToolTip->getPosition() - ToolTip::getDistanceToMouse() - m_lastMousePos);
-
-                remove(m_visibleToolTip);
                 m_visibleToolTip = nullptr;
+                m_container->requestRedraw();
             }
 
             // Reset the data for the tooltip since the mouse has moved
@@ -246,11 +468,106 @@ namespace tgui
         #endif
         }
 
+        // Popups lie on top of all other widgets, so they get the first chance to handle mouse events
+        if ((!m_container->m_popupLayer->getWidgets().empty() || m_mouseDownOnPopup) && handlePopupEvent(event))
+            return true;
+
         return m_container->handleEvent(event);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Gui::handlePopupEvent(sf::Event& event)
+    {
+        PopupLayer& popupLayer = *m_container->m_popupLayer;
+
+        Vector2f mousePos;
+        switch (event.type)
+        {
+            case sf::Event::MouseMoved:
+                mousePos = {static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y)};
+                break;
+            case sf::Event::MouseButtonPressed:
+            case sf::Event::MouseButtonReleased:
+                mousePos = {static_cast<float>(event.mouseButton.x), static_cast<float>(event.mouseButton.y)};
+                break;
+            case sf::Event::MouseWheelScrolled:
+                mousePos = {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)};
+                break;
+            case sf::Event::TouchMoved:
+            case sf::Event::TouchBegan:
+            case sf::Event::TouchEnded:
+                if (event.touch.finger != 0)
+                    return false;
+
+                mousePos = {static_cast<float>(event.touch.x), static_cast<float>(event.touch.y)};
+                break;
+            default:
+                return false;
+        }
+
+        const bool mouseOnPopup = popupLayer.mouseOnWidget(mousePos);
+        if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved))
+        {
+            if (!mouseOnPopup && !m_mouseDownOnPopup)
+            {
+                popupLayer.mouseNoLongerOnWidget();
+                return false;
+            }
+
+            // The widget below the popup no longer has the mouse on top of it
+            if (m_container->m_widgetBelowMouse)
+            {
+                m_container->m_widgetBelowMouse->invalidateCachedBitmap();
+                m_container->m_widgetBelowMouse->mouseNoLongerOnWidget();
+                m_container->m_widgetBelowMouse = nullptr;
+            }
+
+            popupLayer.mouseMoved(mousePos);
+            return true;
+        }
+        else if ((event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan))
+        {
+            if (!mouseOnPopup)
+                return false;
+
+            if ((event.type == sf::Event::TouchBegan) || (event.mouseButton.button == sf::Mouse::Left))
+                m_mouseDownOnPopup = true;
+
+            popupLayer.handleEvent(event);
+            return true;
+        }
+        else if ((event.type == sf::Event::MouseButtonReleased) || (event.type == sf::Event::TouchEnded))
+        {
+            if ((event.type == sf::Event::MouseButtonReleased) && (event.mouseButton.button != sf::Mouse::Left))
+                return false;
+
+            const bool mouseDownOnPopup = m_mouseDownOnPopup;
+            m_mouseDownOnPopup = false;
+
+            if (!mouseOnPopup && !mouseDownOnPopup)
+            {
+                popupLayer.mouseNoLongerDown();
+                return false;
+            }
+
+            // The widgets below the popups may still think that the mouse is down on them (e.g. the combo box that opened it)
+            popupLayer.handleEvent(event);
+            m_container->mouseNoLongerDown();
+            return true;
+        }
+        else // if (event.type == sf::Event::MouseWheelScrolled)
+        {
+            if (!mouseOnPopup)
+                return false;
+
+            popupLayer.handleEvent(event);
+            return true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::enableTabKeyUsage()
     {
         m_TabKeyUsageEnabled = true;
@@ -276,21 +593,102 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        // Pass the events that were queued since the previous frame to the widgets
+        if (m_eventQueueEnabled)
+            handleQueuedEvents();
+
         // Update the time
         if (m_windowFocused)
             updateTime(m_clock.restart());
         else
             m_clock.restart();
 
-        // Change the view
-        const sf::View oldView = m_target->getView();
-        m_target->setView(m_view);
+        // Upload the images that were decoded in the background, within the budget for a single frame.
+        // Widgets showing a texture that finished loading (possibly while another gui was drawn) have to be redrawn.
+        TextureManager::uploadDecodedImages();
+        if (m_finishedAsyncLoadCount != TextureManager::getFinishedAsyncLoadCount())
+        {
+            m_finishedAsyncLoadCount = TextureManager::getFinishedAsyncLoadCount();
+            requestRedraw();
+        }
 
-        // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        {
+            TGUI_PROFILE_SCOPE(Draw, nullptr);
 
-        // Restore the old view
-        m_target->setView(oldView);
+            // Change the view
+            const sf::View oldView = m_target->getView();
+            m_target->setView(m_view);
+
+            // Draw the widgets
+            m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+
+            // The popups and tool tip aren't part of the container, but the opacity of the gui still has to be applied to them
+            const float drawOpacity = priv::getDrawOpacity();
+            priv::setDrawOpacity(drawOpacity * m_container->getInheritedOpacity());
+
+            // Draw the popups (e.g. the list of an open combo box) on top of the widgets
+            m_container->m_popupLayer->drawWidgetContainer(m_target, sf::RenderStates::Default);
+
+            // Draw the tool tip on top of the widgets. Its position is relative to the mouse.
+            if (m_visibleToolTip)
+            {
+                sf::RenderStates states;
+                states.transform.translate(m_lastMousePos + ToolTip::getDistanceToMouse());
+                m_visibleToolTip->draw(*m_target, states);
+            }
+
+            priv::setDrawOpacity(drawOpacity);
+
+            // Restore the old view
+            m_target->setView(oldView);
+        }
+
+        m_container->m_redrawNeeded = false;
+
+        TGUI_PROFILE_END_FRAME();
+        MemoryUsage::endFrame();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isRedrawNeeded() const
+    {
+        if (m_container->m_redrawNeeded || !m_queuedEvents.empty())
+            return true;
+
+        // Images that are loaded in the background are only uploaded while drawing
+        if ((TextureManager::getPendingAsyncLoadCount() > 0) || (m_finishedAsyncLoadCount != TextureManager::getFinishedAsyncLoadCount()))
+            return true;
+
+        // Time doesn't advance while the window isn't focused, so timed changes won't happen then
+        return m_windowFocused && (m_clock.getElapsedTime() >= m_container->m_timeUntilNextChange);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getTimeUntilNextChange() const
+    {
+        if (isRedrawNeeded())
+            return sf::Time::Zero;
+
+        return m_container->m_timeUntilNextChange - m_clock.getElapsedTime();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::requestRedraw()
+    {
+        // The change that the caller made could be inside a widget that is cached as a bitmap
+        m_container->outdateCachedBitmaps();
+        m_container->m_popupLayer->outdateCachedBitmaps();
+        m_container->requestRedraw();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Gui::getVisibleToolTip() const
+    {
+        return m_visibleToolTip;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -374,14 +772,16 @@ namespace tgui
 
     void Gui::focusNextWidget()
     {
-        m_container->focusNextWidget();
+        if (!focusWidgetInTabOrder(false))
+            m_container->focusNextWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Gui::focusPreviousWidget()
     {
-        m_container->focusPreviousWidget();
+        if (!focusWidgetInTabOrder(true))
+            m_container->focusPreviousWidget();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -451,22 +851,34 @@ namespace tgui
 
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
-        m_container->m_animationTimeElapsed = elapsedTime;
-        m_container->update(elapsedTime);
+        TGUI_PROFILE_SCOPE(Update, nullptr);
+
+        // The widgets will report when they change by themselves again while they are being updated
+        m_container->m_timeUntilNextChange = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+        // Only the widgets that are animating or that need to be updated (e.g. to blink the caret) are visited
+        m_container->getAnimationScheduler().update(elapsedTime);
+        if (m_container->getAnimationScheduler().isAnimating())
+            m_container->m_timeUntilNextChange = sf::Time::Zero;
+
+        m_container->m_popupLayer->update(elapsedTime);
 
         if (m_tooltipPossible)
         {
             m_tooltipTime += elapsedTime;
-            if (m_tooltipTime >= ToolTip::getTimeToDisplay())
+            if (m_tooltipTime < ToolTip::getTimeToDisplay())
+                m_container->requestRedraw(ToolTip::getTimeToDisplay() - m_tooltipTime);
+            else
             {
-                Widget::Ptr tooltip = m_container->askToolTip(m_lastMousePos);
+                Widget::Ptr tooltip = findToolTipBelowMouse();
                 if (tooltip)
                 {
-                    m_visibleToolTip = tooltip;
-                    add(tooltip, "#TGUI_INTERNAL$ToolTip#");
+                    // The tool tip uses the font of the gui, like it would when it was added to it
+                    if (m_container->m_fontCached != getGlobalFont())
+                        tooltip->setInheritedFont(m_container->m_fontCached);
 
-                    // Change the relative tool tip position in an absolute one
-                    tooltip->setPosition(m_lastMousePos + ToolTip::getDistanceToMouse() + tooltip->getPosition());
+                    m_visibleToolTip = tooltip;
+                    m_container->requestRedraw();
                 }
 
                 m_tooltipPossible = false;
@@ -476,6 +888,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Gui::findToolTipBelowMouse() const
+    {
+        // Popups lie on top of the other widgets, so when the mouse is on top of a popup then only the popup is asked
+        if (m_container->m_popupLayer->mouseOnWidget(m_lastMousePos))
+            return m_container->m_popupLayer->askToolTip(m_lastMousePos);
+        else
+            return m_container->askToolTip(m_lastMousePos);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::init()
     {
     #ifdef SFML_SYSTEM_WINDOWS
@@ -0,0 +1,1039 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/InputValidator.hpp>
+#include <algorithm>
+#include <iterator>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const std::uint32_t maxCodePoint = 0x10FFFF;
+
+        // Patterns that would result in larger automatons than this are left to std::regex
+        const std::size_t maxNfaStates = 10000;
+        const std::size_t maxDfaStates = 1000;
+        const unsigned int maxRepeatCount = 1000;
+        const unsigned int infiniteRepeat = std::numeric_limits<unsigned int>::max();
+
+        using CharRange = std::pair<std::uint32_t, std::uint32_t>;
+        using CharSet = std::vector<CharRange>;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isDigit(std::uint32_t c)
+        {
+            return (c >= '0') && (c <= '9');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Sorts the ranges and merges the ones that overlap or touch each other
+        CharSet normalizeSet(CharSet set)
+        {
+            std::sort(set.begin(), set.end());
+
+            CharSet result;
+            for (const auto& range : set)
+            {
+                if (!result.empty() && (range.first <= result.back().second + 1))
+                    result.back().second = std::max(result.back().second, range.second);
+                else
+                    result.push_back(range);
+            }
+
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns all characters that are not part of the (normalized) set
+        CharSet invertSet(const CharSet& set)
+        {
+            CharSet result;
+            std::uint32_t next = 0;
+            for (const auto& range : set)
+            {
+                if (range.first > next)
+                    result.push_back({next, range.first - 1});
+
+                next = range.second + 1;
+            }
+
+            if (next <= maxCodePoint)
+                result.push_back({next, maxCodePoint});
+
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool setContains(const CharSet& set, std::uint32_t c)
+        {
+            const auto it = std::upper_bound(set.begin(), set.end(), c,
+                                             [](std::uint32_t value, const CharRange& range){ return value < range.first; });
+
+            return (it != set.begin()) && (c <= std::prev(it)->second);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const CharSet& getDigitSet()
+        {
+            static const CharSet set = {{'0', '9'}};
+            return set;
+        }
+
+        const CharSet& getWordSet()
+        {
+            static const CharSet set = {{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+            return set;
+        }
+
+        const CharSet& getSpaceSet()
+        {
+            static const CharSet set = {{'\t', '\r'}, {' ', ' '}, {0xA0, 0xA0}, {0x1680, 0x1680}, {0x2000, 0x200A},
+                                        {0x2028, 0x2029}, {0x202F, 0x202F}, {0x205F, 0x205F}, {0x3000, 0x3000}, {0xFEFF, 0xFEFF}};
+            return set;
+        }
+
+        const CharSet& getAnyCharacterSet()
+        {
+            // The dot matches everything except line terminators
+            static const CharSet set = invertSet({{'\n', '\n'}, {'\r', '\r'}, {0x2028, 0x2029}});
+            return set;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Node in the syntax tree of the parsed pattern
+        struct Node
+        {
+            enum class Type
+            {
+                Set,        // Matches a single character from the set
+                Concat,     // Matches all children after each other (matches an empty string when there are no children)
+                Alternate,  // Matches one of the children
+                Repeat      // Matches the only child between min and max times
+            };
+
+            explicit Node(Type nodeType) : type{nodeType} {}
+
+            Type type;
+            CharSet set;
+            std::vector<std::unique_ptr<Node>> children;
+            unsigned int min = 0;
+            unsigned int max = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Parses the subset of the ECMAScript regex syntax that can be turned into an automaton.
+        // Whenever something unsupported (or invalid) is found, the parse function returns a nullptr.
+        class Parser
+        {
+        public:
+
+            explicit Parser(const std::string& pattern)
+            {
+                // Decode the pattern as UTF-8, bytes that aren't part of a valid sequence are used as they are
+                for (std::size_t i = 0; i < pattern.size(); ++i)
+                {
+                    const auto byte = static_cast<unsigned char>(pattern[i]);
+                    std::size_t trailingBytes = 0;
+                    std::uint32_t c = byte;
+                    if ((byte & 0xE0) == 0xC0)
+                    {
+                        trailingBytes = 1;
+                        c = byte & 0x1F;
+                    }
+                    else if ((byte & 0xF0) == 0xE0)
+                    {
+                        trailingBytes = 2;
+                        c = byte & 0x0F;
+                    }
+                    else if ((byte & 0xF8) == 0xF0)
+                    {
+                        trailingBytes = 3;
+                        c = byte & 0x07;
+                    }
+
+                    bool validSequence = (i + trailingBytes < pattern.size());
+                    for (std::size_t j = 1; validSequence && (j <= trailingBytes); ++j)
+                    {
+                        const auto trailingByte = static_cast<unsigned char>(pattern[i + j]);
+                        if ((trailingByte & 0xC0) == 0x80)
+                            c = (c << 6) | (trailingByte & 0x3F);
+                        else
+                            validSequence = false;
+                    }
+
+                    if (validSequence && (c <= maxCodePoint))
+                    {
+                        m_chars.push_back(c);
+                        i += trailingBytes;
+                    }
+                    else
+                        m_chars.push_back(byte);
+                }
+
+                m_end = m_chars.size();
+            }
+
+            std::unique_ptr<Node> parse()
+            {
+                // Anchors at the start and end of the pattern have no effect as the whole text always has to match
+                if ((m_end > 0) && (m_chars[0] == '^'))
+                    m_pos = 1;
+
+                if ((m_end > m_pos) && (m_chars[m_end-1] == '$'))
+                {
+                    std::size_t backslashes = 0;
+                    while ((m_end - 1 - backslashes > m_pos) && (m_chars[m_end - 2 - backslashes] == '\\'))
+                        ++backslashes;
+
+                    if (backslashes % 2 == 0)
+                        --m_end;
+                }
+
+                auto node = parseAlternation();
+                if (!node || (m_pos != m_end))
+                    return nullptr;
+
+                return node;
+            }
+
+        private:
+
+            bool atEnd() const
+            {
+                return m_pos >= m_end;
+            }
+
+            std::uint32_t peek(std::size_t offset = 0) const
+            {
+                return (m_pos + offset < m_end) ? m_chars[m_pos + offset] : 0;
+            }
+
+            static std::unique_ptr<Node> makeSetNode(CharSet set)
+            {
+                auto node = std::make_unique<Node>(Node::Type::Set);
+                node->set = std::move(set);
+                return node;
+            }
+
+            std::unique_ptr<Node> parseAlternation()
+            {
+                auto node = parseConcat();
+                if (!node || atEnd() || (peek() != '|'))
+                    return node;
+
+                auto alternation = std::make_unique<Node>(Node::Type::Alternate);
+                alternation->children.push_back(std::move(node));
+                while (!atEnd() && (peek() == '|'))
+                {
+                    ++m_pos;
+                    node = parseConcat();
+                    if (!node)
+                        return nullptr;
+
+                    alternation->children.push_back(std::move(node));
+                }
+
+                return alternation;
+            }
+
+            std::unique_ptr<Node> parseConcat()
+            {
+                auto concat = std::make_unique<Node>(Node::Type::Concat);
+                while (!atEnd() && (peek() != '|') && (peek() != ')'))
+                {
+                    auto node = parseRepeat();
+                    if (!node)
+                        return nullptr;
+
+                    concat->children.push_back(std::move(node));
+                }
+
+                return concat;
+            }
+
+            std::unique_ptr<Node> parseRepeat()
+            {
+                auto atom = parseAtom();
+                if (!atom || atEnd())
+                    return atom;
+
+                unsigned int min;
+                unsigned int max;
+                const std::uint32_t c = peek();
+                if (c == '*')
+                {
+                    min = 0;
+                    max = infiniteRepeat;
+                    ++m_pos;
+                }
+                else if (c == '+')
+                {
+                    min = 1;
+                    max = infiniteRepeat;
+                    ++m_pos;
+                }
+                else if (c == '?')
+                {
+                    min = 0;
+                    max = 1;
+                    ++m_pos;
+                }
+                else if (c == '{')
+                {
+                    ++m_pos;
+                    if (!parseNumber(min))
+                        return nullptr;
+
+                    max = min;
+                    if (!atEnd() && (peek() == ','))
+                    {
+                        ++m_pos;
+                        if (!atEnd() && (peek() == '}'))
+                            max = infiniteRepeat;
+                        else if (!parseNumber(max) || (max < min))
+                            return nullptr;
+                    }
+
+                    if (atEnd() || (peek() != '}'))
+                        return nullptr;
+
+                    ++m_pos;
+                }
+                else
+                    return atom;
+
+                // Whether the quantifier is lazy or greedy doesn't change which texts match
+                if (!atEnd() && (peek() == '?'))
+                    ++m_pos;
+
+                // Leave quantifiers following each other to std::regex
+                if (!atEnd() && ((peek() == '*') || (peek() == '+') || (peek() == '?') || (peek() == '{')))
+                    return nullptr;
+
+                auto repeat = std::make_unique<Node>(Node::Type::Repeat);
+                repeat->min = min;
+                repeat->max = max;
+                repeat->children.push_back(std::move(atom));
+                return repeat;
+            }
+
+            bool parseNumber(unsigned int& number)
+            {
+                if (atEnd() || !isDigit(peek()))
+                    return false;
+
+                number = 0;
+                while (!atEnd() && isDigit(peek()))
+                {
+                    number = (number * 10) + (peek() - '0');
+                    if (number > maxRepeatCount)
+                        return false;
+
+                    ++m_pos;
+                }
+
+                return true;
+            }
+
+            std::unique_ptr<Node> parseAtom()
+            {
+                const std::uint32_t c = m_chars[m_pos++];
+                switch (c)
+                {
+                    case '(':
+                    {
+                        // Non-capturing groups are supported, but lookaheads aren't
+                        if (peek() == '?')
+                        {
+                            if (peek(1) != ':')
+                                return nullptr;
+
+                            m_pos += 2;
+                        }
+
+                        auto node = parseAlternation();
+                        if (!node || atEnd() || (peek() != ')'))
+                            return nullptr;
+
+                        ++m_pos;
+                        return node;
+                    }
+                    case '[':
+                    {
+                        CharSet set;
+                        if (!parseClass(set))
+                            return nullptr;
+
+                        return makeSetNode(std::move(set));
+                    }
+                    case '.':
+                        return makeSetNode(getAnyCharacterSet());
+                    case '\\':
+                    {
+                        CharSet set;
+                        bool singleChar;
+                        if (!parseEscape(set, singleChar))
+                            return nullptr;
+
+                        return makeSetNode(std::move(set));
+                    }
+                    case '*':
+                    case '+':
+                    case '?':
+                    case '{':
+                    case '}':
+                    case ']':
+                    case '^':
+                    case '$':
+                        return nullptr;
+                    default:
+                        return makeSetNode({{c, c}});
+                }
+            }
+
+            // Parses the part after the backslash. The singleChar parameter is set to true when the set contains one character.
+            bool parseEscape(CharSet& set, bool& singleChar)
+            {
+                if (atEnd())
+                    return false;
+
+                singleChar = false;
+                const std::uint32_t c = m_chars[m_pos++];
+                switch (c)
+                {
+                    case 'd':
+                        set = getDigitSet();
+                        return true;
+                    case 'D':
+                        set = invertSet(getDigitSet());
+                        return true;
+                    case 'w':
+                        set = getWordSet();
+                        return true;
+                    case 'W':
+                        set = invertSet(getWordSet());
+                        return true;
+                    case 's':
+                        set = getSpaceSet();
+                        return true;
+                    case 'S':
+                        set = invertSet(getSpaceSet());
+                        return true;
+                    default:
+                        break;
+                }
+
+                singleChar = true;
+                std::uint32_t escapedChar;
+                switch (c)
+                {
+                    case 't':
+                        escapedChar = '\t';
+                        break;
+                    case 'n':
+                        escapedChar = '\n';
+                        break;
+                    case 'r':
+                        escapedChar = '\r';
+                        break;
+                    case 'f':
+                        escapedChar = '\f';
+                        break;
+                    case 'v':
+                        escapedChar = '\v';
+                        break;
+                    case '0':
+                        if (!atEnd() && isDigit(peek()))
+                            return false;
+
+                        escapedChar = 0;
+                        break;
+                    case 'x':
+                        if (!parseHexDigits(2, escapedChar))
+                            return false;
+                        break;
+                    case 'u':
+                        if (!parseHexDigits(4, escapedChar))
+                            return false;
+                        break;
+                    default:
+                        // Back-references, word boundaries and other escaped letters are left to std::regex
+                        if ((c < 128) && (isDigit(c) || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z'))))
+                            return false;
+
+                        escapedChar = c;
+                        break;
+                }
+
+                set = {{escapedChar, escapedChar}};
+                return true;
+            }
+
+            bool parseHexDigits(unsigned int count, std::uint32_t& value)
+            {
+                value = 0;
+                for (unsigned int i = 0; i < count; ++i)
+                {
+                    if (atEnd())
+                        return false;
+
+                    const std::uint32_t c = m_chars[m_pos++];
+                    if (isDigit(c))
+                        value = (value * 16) + (c - '0');
+                    else if ((c >= 'a') && (c <= 'f'))
+                        value = (value * 16) + (c - 'a' + 10);
+                    else if ((c >= 'A') && (c <= 'F'))
+                        value = (value * 16) + (c - 'A' + 10);
+                    else
+                        return false;
+                }
+
+                return true;
+            }
+
+            // Parses a single character or escape sequence inside a bracket expression
+            bool parseClassAtom(CharSet& set, bool& singleChar)
+            {
+                const std::uint32_t c = m_chars[m_pos++];
+                if (c == '\\')
+                    return parseEscape(set, singleChar);
+
+                // Character classes like [:alpha:] are left to std::regex
+                if ((c == '[') && ((peek() == ':') || (peek() == '.') || (peek() == '=')))
+                    return false;
+
+                singleChar = true;
+                set = {{c, c}};
+                return true;
+            }
+
+            // Parses the part after the opening bracket
+            bool parseClass(CharSet& result)
+            {
+                bool negate = false;
+                if (!atEnd() && (peek() == '^'))
+                {
+                    negate = true;
+                    ++m_pos;
+                }
+
+                // An empty class is left to std::regex
+                if (atEnd() || (peek() == ']'))
+                    return false;
+
+                CharSet set;
+                while (true)
+                {
+                    if (atEnd())
+                        return false;
+
+                    if (peek() == ']')
+                    {
+                        ++m_pos;
+                        break;
+                    }
+
+                    CharSet item;
+                    bool singleChar;
+                    if (!parseClassAtom(item, singleChar))
+                        return false;
+
+                    if (!atEnd() && (peek() == '-') && (m_pos + 1 < m_end) && (peek(1) != ']'))
+                    {
+                        ++m_pos;
+
+                        CharSet rangeEnd;
+                        bool singleCharRangeEnd;
+                        if (!singleChar || !parseClassAtom(rangeEnd, singleCharRangeEnd) || !singleCharRangeEnd)
+                            return false;
+
+                        if (rangeEnd[0].first < item[0].first)
+                            return false;
+
+                        set.push_back({item[0].first, rangeEnd[0].first});
+                    }
+                    else
+                        set.insert(set.end(), item.begin(), item.end());
+                }
+
+                result = normalizeSet(std::move(set));
+                if (negate)
+                    result = invertSet(result);
+
+                return true;
+            }
+
+        private:
+
+            std::vector<std::uint32_t> m_chars;
+            std::size_t m_pos = 0;
+            std::size_t m_end = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Nondeterministic automaton that is build from the syntax tree with Thompson's construction
+        class Nfa
+        {
+        public:
+
+            struct NfaState
+            {
+                std::vector<std::size_t> epsilonTargets;
+                CharSet set; // The state has a transition to setTarget when the set isn't empty
+                std::size_t setTarget = 0;
+            };
+
+            bool build(const Node& root)
+            {
+                return addNode(root, m_startState, m_acceptingState);
+            }
+
+            const std::vector<NfaState>& getStates() const
+            {
+                return m_states;
+            }
+
+            std::size_t getStartState() const
+            {
+                return m_startState;
+            }
+
+            std::size_t getAcceptingState() const
+            {
+                return m_acceptingState;
+            }
+
+        private:
+
+            bool addState(std::size_t& index)
+            {
+                if (m_states.size() >= maxNfaStates)
+                    return false;
+
+                index = m_states.size();
+                m_states.emplace_back();
+                return true;
+            }
+
+            bool addNode(const Node& node, std::size_t& start, std::size_t& end)
+            {
+                switch (node.type)
+                {
+                    case Node::Type::Set:
+                    {
+                        if (!addState(start) || !addState(end))
+                            return false;
+
+                        m_states[start].set = node.set;
+                        m_states[start].setTarget = end;
+                        return true;
+                    }
+                    case Node::Type::Concat:
+                    {
+                        if (!addState(start))
+                            return false;
+
+                        end = start;
+                        for (const auto& child : node.children)
+                        {
+                            std::size_t childStart;
+                            std::size_t childEnd;
+                            if (!addNode(*child, childStart, childEnd))
+                                return false;
+
+                            m_states[end].epsilonTargets.push_back(childStart);
+                            end = childEnd;
+                        }
+                        return true;
+                    }
+                    case Node::Type::Alternate:
+                    {
+                        if (!addState(start) || !addState(end))
+                            return false;
+
+                        for (const auto& child : node.children)
+                        {
+                            std::size_t childStart;
+                            std::size_t childEnd;
+                            if (!addNode(*child, childStart, childEnd))
+                                return false;
+
+                            m_states[start].epsilonTargets.push_back(childStart);
+                            m_states[childEnd].epsilonTargets.push_back(end);
+                        }
+                        return true;
+                    }
+                    case Node::Type::Repeat:
+                    {
+                        if (!addState(start))
+                            return false;
+
+                        // The mandatory repetitions are placed after each other
+                        std::size_t current = start;
+                        for (unsigned int i = 0; i < node.min; ++i)
+                        {
+                            std::size_t childStart;
+                            std::size_t childEnd;
+                            if (!addNode(*node.children[0], childStart, childEnd))
+                                return false;
+
+                            m_states[current].epsilonTargets.push_back(childStart);
+                            current = childEnd;
+                        }
+
+                        if (!addState(end))
+                            return false;
+
+                        if (node.max == infiniteRepeat)
+                        {
+                            std::size_t childStart;
+                            std::size_t childEnd;
+                            if (!addNode(*node.children[0], childStart, childEnd))
+                                return false;
+
+                            m_states[current].epsilonTargets.push_back(childStart);
+                            m_states[current].epsilonTargets.push_back(end);
+                            m_states[childEnd].epsilonTargets.push_back(childStart);
+                            m_states[childEnd].epsilonTargets.push_back(end);
+                        }
+                        else
+                        {
+                            // Every optional repetition can be skipped to go straight to the end
+                            for (unsigned int i = node.min; i < node.max; ++i)
+                            {
+                                std::size_t childStart;
+                                std::size_t childEnd;
+                                if (!addNode(*node.children[0], childStart, childEnd))
+                                    return false;
+
+                                m_states[current].epsilonTargets.push_back(childStart);
+                                m_states[current].epsilonTargets.push_back(end);
+                                current = childEnd;
+                            }
+
+                            m_states[current].epsilonTargets.push_back(end);
+                        }
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+        private:
+
+            std::vector<NfaState> m_states;
+            std::size_t m_startState = 0;
+            std::size_t m_acceptingState = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds all states that can be reached without consuming a character and returns them sorted
+        std::vector<std::size_t> epsilonClosure(const Nfa& nfa, std::vector<std::size_t> states)
+        {
+            const auto& nfaStates = nfa.getStates();
+            std::vector<bool> visited(nfaStates.size(), false);
+            for (const auto state : states)
+                visited[state] = true;
+
+            std::vector<std::size_t> stack = states;
+            while (!stack.empty())
+            {
+                const std::size_t state = stack.back();
+                stack.pop_back();
+
+                for (const auto target : nfaStates[state].epsilonTargets)
+                {
+                    if (!visited[target])
+                    {
+                        visited[target] = true;
+                        states.push_back(target);
+                        stack.push_back(target);
+                    }
+                }
+            }
+
+            std::sort(states.begin(), states.end());
+            return states;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TGUI_USE_CPP17
+    constexpr InputValidator::State InputValidator::DeadState;
+#endif
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::InputValidator(const std::string& pattern) :
+        m_pattern{pattern}
+    {
+        // The predefined validators from EditBox::Validator are checked with hand-written scanners
+        if (m_pattern == ".*")
+            m_type = Type::All;
+        else if (m_pattern == "[0-9]*")
+            m_type = Type::UInt;
+        else if (m_pattern == "[+-]?[0-9]*")
+            m_type = Type::Int;
+        else if (m_pattern == "[+-]?[0-9]*\\.?[0-9]*")
+            m_type = Type::Float;
+        else if (compile())
+            m_type = Type::Automaton;
+        else
+        {
+            m_type = Type::Regex;
+            m_regex = std::regex{m_pattern};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& InputValidator::getPattern() const
+    {
+        return m_pattern;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::acceptsEverything() const
+    {
+        return m_type == Type::All;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::isIncremental() const
+    {
+        return m_type != Type::Regex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::validate(const sf::String& text) const
+    {
+        if (m_type == Type::All)
+            return true;
+
+        if (m_type == Type::Regex)
+            return std::regex_match(text.toAnsiString(), m_regex);
+
+        State state = getStartState();
+        for (const auto c : text)
+        {
+            state = advance(state, c);
+            if (state == DeadState)
+                return false;
+        }
+
+        return isAccepting(state);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::State InputValidator::getStartState() const
+    {
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::State InputValidator::advance(State state, std::uint32_t character) const
+    {
+        if (state == DeadState)
+            return DeadState;
+
+        const bool digit = isDigit(character);
+        switch (m_type)
+        {
+            case Type::All:
+                return 0;
+
+            case Type::UInt: // [0-9]*
+                return digit ? 0 : DeadState;
+
+            case Type::Int: // [+-]?[0-9]*
+            {
+                // State 0 is the start, state 1 is reached once a sign or digit was found
+                if (digit || ((state == 0) && ((character == '+') || (character == '-'))))
+                    return 1;
+                else
+                    return DeadState;
+            }
+
+            case Type::Float: // [+-]?[0-9]*\.?[0-9]*
+            {
+                // State 0 is the start, state 1 is inside the integer part and state 2 is behind the decimal point
+                if (digit)
+                    return (state == 0) ? 1 : state;
+                else if ((state == 0) && ((character == '+') || (character == '-')))
+                    return 1;
+                else if ((state != 2) && (character == '.'))
+                    return 2;
+                else
+                    return DeadState;
+            }
+
+            case Type::Automaton:
+            {
+                const auto first = m_transitions.begin() + m_transitionsStart[state];
+                const auto last = m_transitions.begin() + m_transitionsStart[state + 1];
+                const auto it = std::upper_bound(first, last, character,
+                                                 [](std::uint32_t value, const Transition& transition){ return value < transition.first; });
+
+                if ((it != first) && (character <= std::prev(it)->last))
+                    return std::prev(it)->target;
+                else
+                    return DeadState;
+            }
+
+            case Type::Regex:
+                return DeadState;
+        }
+
+        return DeadState;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::isAccepting(State state) const
+    {
+        if (state == DeadState)
+            return false;
+
+        if (m_type == Type::Automaton)
+            return m_acceptingStates[state];
+        else
+            return m_type != Type::Regex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::compile()
+    {
+        Parser parser{m_pattern};
+        const auto root = parser.parse();
+        if (!root)
+            return false;
+
+        Nfa nfa;
+        if (!nfa.build(*root))
+            return false;
+
+        // Split all characters into intervals in which every character has the same transitions in the nfa
+        const auto& nfaStates = nfa.getStates();
+        std::vector<std::uint32_t> intervalStarts = {0};
+        for (const auto& nfaState : nfaStates)
+        {
+            for (const auto& range : nfaState.set)
+            {
+                intervalStarts.push_back(range.first);
+                if (range.second < maxCodePoint)
+                    intervalStarts.push_back(range.second + 1);
+            }
+        }
+
+        std::sort(intervalStarts.begin(), intervalStarts.end());
+        intervalStarts.erase(std::unique(intervalStarts.begin(), intervalStarts.end()), intervalStarts.end());
+
+        // Build the deterministic automaton with the subset construction
+        std::map<std::vector<std::size_t>, State> dfaStateIds;
+        std::vector<std::vector<std::size_t>> dfaStates;
+
+        dfaStates.push_back(epsilonClosure(nfa, {nfa.getStartState()}));
+        dfaStateIds[dfaStates[0]] = 0;
+
+        m_transitions.clear();
+        m_transitionsStart.clear();
+        m_acceptingStates.clear();
+        for (std::size_t i = 0; i < dfaStates.size(); ++i)
+        {
+            m_transitionsStart.push_back(m_transitions.size());
+            m_acceptingStates.push_back(std::binary_search(dfaStates[i].begin(), dfaStates[i].end(), nfa.getAcceptingState()));
+
+            for (std::size_t j = 0; j < intervalStarts.size(); ++j)
+            {
+                const std::uint32_t intervalFirst = intervalStarts[j];
+                const std::uint32_t intervalLast = (j + 1 < intervalStarts.size()) ? intervalStarts[j+1] - 1 : maxCodePoint;
+
+                std::vector<std::size_t> targets;
+                for (const auto nfaState : dfaStates[i])
+                {
+                    if (setContains(nfaStates[nfaState].set, intervalFirst))
+                        targets.push_back(nfaStates[nfaState].setTarget);
+                }
+
+                if (targets.empty())
+                    continue;
+
+                targets = epsilonClosure(nfa, std::move(targets));
+
+                State target;
+                const auto it = dfaStateIds.find(targets);
+                if (it != dfaStateIds.end())
+                    target = it->second;
+                else
+                {
+                    if (dfaStates.size() >= maxDfaStates)
+                        return false;
+
+                    target = static_cast<State>(dfaStates.size());
+                    dfaStateIds[targets] = target;
+                    dfaStates.push_back(std::move(targets));
+                }
+
+                // Merge the interval with the previous one when they lead to the same state
+                if ((m_transitions.size() > m_transitionsStart.back())
+                 && (m_transitions.back().target == target)
+                 && (m_transitions.back().last + 1 == intervalFirst))
+                {
+                    m_transitions.back().last = intervalLast;
+                }
+                else
+                    m_transitions.push_back({intervalFirst, intervalLast, target});
+            }
+        }
+
+        m_transitionsStart.push_back(m_transitions.size());
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
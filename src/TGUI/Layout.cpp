@@ -27,6 +27,7 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Gui.hpp>
 #include <TGUI/to_string.hpp>
+#include <TGUI/MemoryPool.hpp>
 #include <SFML/System/Err.hpp>
 #include <cassert>
 
@@ -346,6 +347,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void* Layout::operator new(std::size_t size)
+    {
+        // The memory starts with a header that remembers where it came from, as the pool can be disabled at any time
+        const bool usePool = MemoryPool::isEnabled();
+        const std::size_t headerSize = alignof(std::max_align_t);
+        void* block = usePool ? MemoryPool::allocate(size + headerSize) : ::operator new(size + headerSize);
+        *static_cast<bool*>(block) = usePool;
+        return static_cast<char*>(block) + headerSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::operator delete(void* ptr, std::size_t size)
+    {
+        if (!ptr)
+            return;
+
+        const std::size_t headerSize = alignof(std::max_align_t);
+        void* block = static_cast<char*>(ptr) - headerSize;
+        if (*static_cast<bool*>(block))
+            MemoryPool::deallocate(block, size + headerSize);
+        else
+            ::operator delete(block);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::string Layout::toString() const
     {
         if (m_operation == Operation::Value)
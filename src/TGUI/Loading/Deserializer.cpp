@@ -27,6 +27,7 @@
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/FontManager.hpp>
 #include <cstdint>
 #include <cassert>
 
@@ -96,17 +97,14 @@ namespace tgui
                 return Font{};
 
             // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = std::make_shared<sf::Font>();
         #ifdef SFML_SYSTEM_WINDOWS
             if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
         #else
             if (filename[0] != '/')
         #endif
-                font->loadFromFile(getResourcePath() + filename);
+                return Font(FontManager::getFontFromFile(getResourcePath() + filename));
             else
-                font->loadFromFile(filename);
-
-            return Font(font);
+                return Font(FontManager::getFontFromFile(filename));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
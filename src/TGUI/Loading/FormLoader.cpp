@@ -0,0 +1,324 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Loading/FormLoader.hpp>
+#include <TGUI/Container.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Texture.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <set>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        bool isAbsolutePath(const std::string& filename)
+        {
+        #ifdef SFML_SYSTEM_WINDOWS
+            return (filename[0] == '/') || (filename[0] == '\\') || ((filename.size() > 1) && (filename[1] == ':'));
+        #else
+            return filename[0] == '/';
+        #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the filename that the Texture class will pass to the image loader when deserializing the value.
+        // The resource path is inserted in the same places as the deserializer and Texture::load would do it.
+        std::string getTextureFilename(const std::string& value, const std::string& resourcePath)
+        {
+            if (value.empty() || (toLower(value) == "none"))
+                return "";
+
+            std::string id;
+            if (value[0] != '"')
+            {
+                id = isAbsolutePath(value) ? value : resourcePath + value;
+            }
+            else
+            {
+                char prev = '\0';
+                bool filenameFound = false;
+                for (auto c = value.begin() + 1; c != value.end(); ++c)
+                {
+                    if ((*c == '"') && (prev != '\\'))
+                    {
+                        filenameFound = true;
+                        break;
+                    }
+
+                    prev = *c;
+                    id.push_back(*c);
+                }
+
+                // Invalid values are left for the deserializer to report
+                if (!filenameFound || id.empty())
+                    return "";
+            }
+
+            if (isAbsolutePath(id))
+                return id;
+            else
+                return resourcePath + id;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void findTextureFilenames(const DataIO::Node& node, const std::string& resourcePath, std::set<std::string>& filenames)
+        {
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                if (!pair.second || pair.second->listNode)
+                    continue;
+
+                const std::string property = toLower(pair.first);
+                if ((property.compare(0, 7, "texture") == 0) || (property == "image"))
+                {
+                    const std::string filename = getTextureFilename(trim(pair.second->value), resourcePath);
+                    if (!filename.empty())
+                        filenames.insert(filename);
+                }
+            }
+
+            for (const auto& child : node.children)
+                findTextureFilenames(*child, resourcePath, filenames);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Makes the Texture class use the decoded images while the widgets are being loaded
+        class ImageLoaderOverride
+        {
+        public:
+            // The images are shared with the loader, as the TextureManager may still call it later when loading asynchronously
+            ImageLoaderOverride(std::shared_ptr<const std::map<sf::String, std::unique_ptr<sf::Image>>> images) :
+                m_previousLoader{Texture::getImageLoader()}
+            {
+                const auto previousLoader = m_previousLoader;
+                Texture::setImageLoader([images,previousLoader](const sf::String& filename) -> std::unique_ptr<sf::Image>
+                    {
+                        // The image is copied because the same file can be used with different part rectangles
+                        const auto it = images->find(filename);
+                        if ((it != images->end()) && it->second)
+                            return std::make_unique<sf::Image>(*it->second);
+                        else
+                            return previousLoader(filename);
+                    });
+            }
+
+            ~ImageLoaderOverride()
+            {
+                Texture::setImageLoader(m_previousLoader);
+            }
+
+            ImageLoaderOverride(const ImageLoaderOverride&) = delete;
+            ImageLoaderOverride& operator=(const ImageLoaderOverride&) = delete;
+
+        private:
+            Texture::ImageLoaderFunc m_previousLoader;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FormLoader::FormLoader(unsigned int threadCount)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        m_threads.reserve(threadCount);
+        for (unsigned int i = 0; i < threadCount; ++i)
+            m_threads.emplace_back(&FormLoader::runWorker, this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FormLoader::~FormLoader()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stopping = true;
+        }
+
+        m_taskAdded.notify_all();
+        for (auto& thread : m_threads)
+            thread.join();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int FormLoader::getThreadCount() const
+    {
+        return static_cast<unsigned int>(m_threads.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormLoader::loadFileAsync(const std::string& filename)
+    {
+        const std::string resourcePath = getResourcePath();
+        const Texture::ImageLoaderFunc imageLoader = Texture::getImageLoader();
+
+        std::lock_guard<std::mutex> lock{m_mutex};
+        if (m_forms.find(filename) != m_forms.end())
+            return;
+
+        auto form = std::make_shared<Form>();
+        form->pendingTasks = 1;
+        m_forms[filename] = form;
+
+        addTask([=]{ prepareForm(form, filename, resourcePath, imageLoader); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FormLoader::isLoaded(const std::string& filename) const
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        const auto it = m_forms.find(filename);
+        return (it != m_forms.end()) && (it->second->pendingTasks == 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormLoader::loadWidgets(Container& container, const std::string& filename)
+    {
+        loadFileAsync(filename);
+
+        std::shared_ptr<Form> form;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            form = m_forms[filename];
+            m_taskFinished.wait(lock, [&form]{ return form->pendingTasks == 0; });
+            m_forms.erase(filename);
+        }
+
+        if (form->error)
+            std::rethrow_exception(form->error);
+
+        ImageLoaderOverride imageLoaderOverride{std::shared_ptr<const std::map<sf::String, std::unique_ptr<sf::Image>>>(form, &form->images)};
+        container.loadWidgetsFromNodeTree(form->rootNode);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormLoader::prepareForm(const std::shared_ptr<Form>& form, const std::string& filename, const std::string& resourcePath,
+                                 const std::function<std::unique_ptr<sf::Image>(const sf::String&)>& imageLoader)
+    {
+        try
+        {
+            std::ifstream in{filename};
+            if (!in.is_open())
+                throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
+
+            std::stringstream stream;
+            stream << in.rdbuf();
+            auto rootNode = DataIO::parse(stream);
+
+            std::set<std::string> imageFilenames;
+            findTextureFilenames(*rootNode, resourcePath, imageFilenames);
+
+            std::lock_guard<std::mutex> lock{m_mutex};
+            form->rootNode = std::move(rootNode);
+
+            // Every image is decoded in a separate task, so that a single form can also use multiple threads
+            for (const auto& imageFilename : imageFilenames)
+            {
+                ++form->pendingTasks;
+                addTask([this,form,imageFilename,imageLoader]{
+                        std::unique_ptr<sf::Image> image;
+                        try
+                        {
+                            image = imageLoader(imageFilename);
+                        }
+                        catch (...)
+                        {
+                            // The image will be loaded again on the main thread, where the error will be reported
+                        }
+
+                        std::lock_guard<std::mutex> imageLock{m_mutex};
+                        form->images[imageFilename] = std::move(image);
+                        finishTask(*form);
+                    });
+            }
+
+            finishTask(*form);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            form->error = std::current_exception();
+            finishTask(*form);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormLoader::finishTask(Form& form)
+    {
+        --form.pendingTasks;
+        if (form.pendingTasks == 0)
+            m_taskFinished.notify_all();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormLoader::addTask(std::function<void()> task)
+    {
+        m_tasks.push_back(std::move(task));
+        m_taskAdded.notify_one();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FormLoader::runWorker()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                m_taskAdded.wait(lock, [this]{ return m_stopping || !m_tasks.empty(); });
+                if (m_stopping)
+                    return;
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,37 +61,37 @@ namespace tgui
 {
     std::map<std::string, std::function<Widget::Ptr()>> WidgetFactory::m_constructFunctions =
     {
-        {"bitmapbutton", std::make_shared<BitmapButton>},
-        {"button", std::make_shared<Button>},
-        {"canvas", std::make_shared<Canvas>},
-        {"chatbox", std::make_shared<ChatBox>},
-        {"checkbox", std::make_shared<CheckBox>},
-        {"childwindow", std::make_shared<ChildWindow>},
-        {"clickablewidget", std::make_shared<ClickableWidget>},
-        {"combobox", std::make_shared<ComboBox>},
-        {"editbox", std::make_shared<EditBox>},
-        {"grid", std::make_shared<Grid>},
-        {"group", std::make_shared<Group>},
-        {"horizontallayout", std::make_shared<HorizontalLayout>},
-        {"horizontalwrap", std::make_shared<HorizontalWrap>},
-        {"knob", std::make_shared<Knob>},
-        {"label", std::make_shared<Label>},
-        {"listbox", std::make_shared<ListBox>},
-        {"menubar", std::make_shared<MenuBar>},
-        {"messagebox", std::make_shared<MessageBox>},
-        {"panel", std::make_shared<Panel>},
-        {"picture", std::make_shared<Picture>},
-        {"progressbar", std::make_shared<ProgressBar>},
-        {"radiobutton", std::make_shared<RadioButton>},
-        {"radiobuttongroup", std::make_shared<RadioButtonGroup>},
-        {"rangeslider", std::make_shared<RangeSlider>},
-        {"scrollablepanel", std::make_shared<ScrollablePanel>},
-        {"scrollbar", std::make_shared<Scrollbar>},
-        {"slider", std::make_shared<Slider>},
-        {"spinbutton", std::make_shared<SpinButton>},
-        {"tabs", std::make_shared<Tabs>},
-        {"textbox", std::make_shared<TextBox>},
-        {"verticallayout", std::make_shared<VerticalLayout>}
+        {"bitmapbutton", makePooled<BitmapButton>},
+        {"button", makePooled<Button>},
+        {"canvas", makePooled<Canvas>},
+        {"chatbox", makePooled<ChatBox>},
+        {"checkbox", makePooled<CheckBox>},
+        {"childwindow", makePooled<ChildWindow>},
+        {"clickablewidget", makePooled<ClickableWidget>},
+        {"combobox", makePooled<ComboBox>},
+        {"editbox", makePooled<EditBox>},
+        {"grid", makePooled<Grid>},
+        {"group", makePooled<Group>},
+        {"horizontallayout", makePooled<HorizontalLayout>},
+        {"horizontalwrap", makePooled<HorizontalWrap>},
+        {"knob", makePooled<Knob>},
+        {"label", makePooled<Label>},
+        {"listbox", makePooled<ListBox>},
+        {"menubar", makePooled<MenuBar>},
+        {"messagebox", makePooled<MessageBox>},
+        {"panel", makePooled<Panel>},
+        {"picture", makePooled<Picture>},
+        {"progressbar", makePooled<ProgressBar>},
+        {"radiobutton", makePooled<RadioButton>},
+        {"radiobuttongroup", makePooled<RadioButtonGroup>},
+        {"rangeslider", makePooled<RangeSlider>},
+        {"scrollablepanel", makePooled<ScrollablePanel>},
+        {"scrollbar", makePooled<Scrollbar>},
+        {"slider", makePooled<Slider>},
+        {"spinbutton", makePooled<SpinButton>},
+        {"tabs", makePooled<Tabs>},
+        {"textbox", makePooled<TextBox>},
+        {"verticallayout", makePooled<VerticalLayout>}
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
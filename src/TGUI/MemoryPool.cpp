@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/MemoryPool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <mutex>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Every block size is a multiple of this, which keeps the blocks aligned for any fundamental type
+        constexpr std::size_t BlockSizeStep = 32;
+        constexpr std::size_t BlockSizeCount = MemoryPool::MaxBlockSize / BlockSizeStep;
+
+        // Each time a block size runs out of free blocks, a chunk of this size is split into new blocks
+        constexpr std::size_t ChunkSize = 64 * 1024;
+        constexpr std::size_t MinBlocksPerChunk = 8;
+
+        static_assert(BlockSizeStep % alignof(std::max_align_t) == 0, "Blocks must be aligned for every fundamental type");
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct PoolState
+        {
+            std::mutex mutex;
+            FreeBlock* freeBlocks[BlockSizeCount] = {};
+            std::size_t reservedBytes = 0;
+            std::size_t usedBytes = 0;
+        };
+
+        PoolState& getPoolState()
+        {
+            // The state is never destroyed, widgets stored in static objects may still release their memory after the
+            // destructors of other static objects have been called. The system reclaims the chunks when the program ends.
+            static PoolState* state = new PoolState;
+            return *state;
+        }
+
+        std::atomic<bool> poolEnabled{true};
+
+        std::size_t getBlockSizeIndex(std::size_t bytes)
+        {
+            return (std::max<std::size_t>(bytes, 1) - 1) / BlockSizeStep;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    constexpr std::size_t MemoryPool::MaxBlockSize;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void* MemoryPool::allocate(std::size_t bytes)
+    {
+        if (bytes > MaxBlockSize)
+            return ::operator new(bytes);
+
+        const std::size_t index = getBlockSizeIndex(bytes);
+        const std::size_t blockSize = (index + 1) * BlockSizeStep;
+
+        PoolState& state = getPoolState();
+        std::lock_guard<std::mutex> lock{state.mutex};
+
+        if (!state.freeBlocks[index])
+        {
+            const std::size_t blockCount = std::max(MinBlocksPerChunk, ChunkSize / blockSize);
+            char* chunk = static_cast<char*>(::operator new(blockCount * blockSize));
+            state.reservedBytes += blockCount * blockSize;
+
+            // Link the blocks of the new chunk together, in order of their address
+            for (std::size_t i = blockCount; i > 0; --i)
+            {
+                auto* block = reinterpret_cast<FreeBlock*>(chunk + (i - 1) * blockSize);
+                block->next = state.freeBlocks[index];
+                state.freeBlocks[index] = block;
+            }
+        }
+
+        FreeBlock* block = state.freeBlocks[index];
+        state.freeBlocks[index] = block->next;
+        state.usedBytes += blockSize;
+        return block;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryPool::deallocate(void* ptr, std::size_t bytes) noexcept
+    {
+        if (!ptr)
+            return;
+
+        if (bytes > MaxBlockSize)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        const std::size_t index = getBlockSizeIndex(bytes);
+
+        PoolState& state = getPoolState();
+        std::lock_guard<std::mutex> lock{state.mutex};
+
+        auto* block = static_cast<FreeBlock*>(ptr);
+        block->next = state.freeBlocks[index];
+        state.freeBlocks[index] = block;
+        state.usedBytes -= (index + 1) * BlockSizeStep;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryPool::setEnabled(bool enabled)
+    {
+        poolEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MemoryPool::isEnabled()
+    {
+        return poolEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryPool::getReservedBytes()
+    {
+        PoolState& state = getPoolState();
+        std::lock_guard<std::mutex> lock{state.mutex};
+        return state.reservedBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryPool::getUsedBytes()
+    {
+        PoolState& state = getPoolState();
+        std::lock_guard<std::mutex> lock{state.mutex};
+        return state.usedBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
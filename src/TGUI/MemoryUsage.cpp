@@ -0,0 +1,313 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/MemoryUsage.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <atomic>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Counters of the allocation hooks. They are only atomics, so that they can be updated from inside operator new.
+        std::atomic<std::size_t> allocationCount{0};
+        std::atomic<std::size_t> deallocationCount{0};
+        std::atomic<std::size_t> bytesAllocated{0};
+        std::atomic<std::size_t> bytesFreed{0};
+
+        // Values of the counters when the last frame ended, and the allocations that were made during the last frame
+        MemoryUsage::AllocationStats frameStart;
+        MemoryUsage::AllocationStats lastFrame;
+
+        std::size_t getStringBytes(const sf::String& string)
+        {
+            return string.getSize() * sizeof(sf::Uint32);
+        }
+
+        std::size_t getPixelBytes(sf::Vector2u size)
+        {
+            return static_cast<std::size_t>(size.x) * size.y * 4;
+        }
+
+        MemoryUsage::AllocationStats getCounters()
+        {
+            MemoryUsage::AllocationStats stats;
+            stats.allocations = allocationCount.load(std::memory_order_relaxed);
+            stats.deallocations = deallocationCount.load(std::memory_order_relaxed);
+            stats.bytesAllocated = bytesAllocated.load(std::memory_order_relaxed);
+            stats.bytesFreed = bytesFreed.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        MemoryUsage::AllocationStats subtract(const MemoryUsage::AllocationStats& left, const MemoryUsage::AllocationStats& right)
+        {
+            MemoryUsage::AllocationStats stats;
+            stats.allocations = left.allocations - right.allocations;
+            stats.deallocations = left.deallocations - right.deallocations;
+            stats.bytesAllocated = left.bytesAllocated - right.bytesAllocated;
+            stats.bytesFreed = left.bytesFreed - right.bytesFreed;
+            return stats;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage::MemoryUsage()
+    {
+        for (const auto& pair : TextureManager::m_imageMap)
+        {
+            for (const auto& holder : pair.second)
+                addTextureData(holder.data);
+        }
+
+        for (const auto& file : DefaultThemeLoader::m_propertiesCache)
+        {
+            m_themeCacheBytes += file.first.capacity();
+            for (const auto& section : file.second)
+            {
+                m_themeCacheBytes += section.first.capacity();
+                for (const auto& property : section.second)
+                    m_themeCacheBytes += getStringBytes(property.first) + getStringBytes(property.second);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addGui(const Gui& gui)
+    {
+        addWidget(*gui.getContainer());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addWidget(const Widget& widget)
+    {
+        if (!m_countedObjects.insert(&widget).second)
+            return;
+
+        widget.reportMemoryUsage(*this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addTheme(const Theme& theme)
+    {
+        for (const auto& pair : theme.m_renderers)
+            addRendererData(pair.second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryUsage::getTextureImageBytes() const
+    {
+        return m_textureImageBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryUsage::getTextureGpuBytes() const
+    {
+        return m_textureGpuBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryUsage::getFontBytes() const
+    {
+        return m_fontBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryUsage::getThemeCacheBytes() const
+    {
+        return m_themeCacheBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryUsage::getRendererDataBytes() const
+    {
+        return m_rendererDataBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryUsage::getWidgetBytes() const
+    {
+        return m_widgetBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MemoryUsage::getTotalBytes() const
+    {
+        return m_textureImageBytes + m_textureGpuBytes + m_fontBytes + m_themeCacheBytes + m_rendererDataBytes + m_widgetBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addWidgetBytes(std::size_t bytes)
+    {
+        m_widgetBytes += bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addString(const sf::String& string)
+    {
+        m_widgetBytes += getStringBytes(string);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addText(const Text& text)
+    {
+        // The sf::Text stores a copy of the string and 6 vertices per character (two triangles).
+        // Copies of a text share the sf::Text until they are changed, so it is only counted once.
+        const sf::String& string = text.getString();
+        m_widgetBytes += sizeof(Text);
+        if (m_countedObjects.insert(text.m_text.get()).second)
+            m_widgetBytes += sizeof(sf::Text) + getStringBytes(string) + string.getSize() * 6 * sizeof(sf::Vertex);
+
+        // The glyph page only exists once a text with that character size has been created
+        const Font font = text.getFont();
+        if (string.isEmpty() || !font)
+            return;
+
+        const auto fontPage = std::make_pair(static_cast<const sf::Font*>(font.getFont().get()), text.getCharacterSize());
+        if (m_countedFontPages.insert(fontPage).second)
+            m_fontBytes += getPixelBytes(fontPage.first->getTexture(fontPage.second).getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addRendererData(const std::shared_ptr<RendererData>& data)
+    {
+        if (!data || !m_countedObjects.insert(data.get()).second)
+            return;
+
+        m_rendererDataBytes += sizeof(RendererData);
+        for (const auto& pair : data->propertyValuePairs)
+        {
+            m_rendererDataBytes += pair.first.capacity();
+            addObjectConverter(pair.second);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addTextureData(const std::shared_ptr<TextureData>& data)
+    {
+        if (!data || !m_countedObjects.insert(data.get()).second)
+            return;
+
+        if (data->image)
+            m_textureImageBytes += getPixelBytes(data->image->getSize());
+
+        m_textureImageBytes += data->alphaMask.capacity() * sizeof(std::uint32_t);
+        m_textureGpuBytes += getPixelBytes(data->texture.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addTextureGpuBytes(std::size_t bytes)
+    {
+        m_textureGpuBytes += bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::recordAllocation(std::size_t bytes)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::recordDeallocation(std::size_t bytes)
+    {
+        deallocationCount.fetch_add(1, std::memory_order_relaxed);
+        bytesFreed.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage::AllocationStats MemoryUsage::getCurrentFrameAllocations()
+    {
+        return subtract(getCounters(), frameStart);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryUsage::AllocationStats MemoryUsage::getLastFrameAllocations()
+    {
+        return lastFrame;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::endFrame()
+    {
+        const AllocationStats counters = getCounters();
+        lastFrame = subtract(counters, frameStart);
+        frameStart = counters;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryUsage::addObjectConverter(const ObjectConverter& value)
+    {
+        m_rendererDataBytes += sizeof(ObjectConverter);
+        if (value.m_serialized)
+            m_rendererDataBytes += getStringBytes(value.m_string);
+
+        // Textures and nested renderers are shared, so they are only counted once
+    #ifdef TGUI_USE_CPP17
+        if (value.m_type == ObjectConverter::Type::Texture)
+            addTextureData(std::get<Texture>(value.m_value).getData());
+        else if (value.m_type == ObjectConverter::Type::RendererData)
+            addRendererData(std::get<std::shared_ptr<RendererData>>(value.m_value));
+    #else
+        if (value.m_type == ObjectConverter::Type::Texture)
+            addTextureData(value.m_value.as<Texture>().getData());
+        else if (value.m_type == ObjectConverter::Type::RendererData)
+            addRendererData(value.m_value.as<std::shared_ptr<RendererData>>());
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/PopupLayer.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    PopupLayer::PopupLayer(GuiContainer* guiContainer) :
+        m_guiContainer{guiContainer}
+    {
+        m_type = "PopupLayer";
+
+        // The layer isn't one of the widgets of the gui, but the popups still need to find the gui through their parents
+        setParent(guiContainer);
+        setSize({"100%", "100%"});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PopupLayer::openPopup(const Widget::Ptr& popup, const Widget::Ptr& owner)
+    {
+        add(popup);
+        m_owners.push_back(owner);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PopupLayer::closePopup(const Widget::Ptr& popup)
+    {
+        return remove(popup);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr PopupLayer::getPopupOfOwner(const Widget* owner) const
+    {
+        for (std::size_t i = 0; i < m_owners.size(); ++i)
+        {
+            if (m_owners[i].lock().get() == owner)
+                return m_widgets[i];
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PopupLayer::remove(const Widget::Ptr& widget)
+    {
+        const auto it = std::find(m_widgets.begin(), m_widgets.end(), widget);
+        if (it == m_widgets.end())
+            return false;
+
+        m_owners.erase(m_owners.begin() + (it - m_widgets.begin()));
+        Container::remove(widget);
+
+        releaseFocusWhenEmpty();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PopupLayer::removeAllWidgets()
+    {
+        m_owners.clear();
+        Container::removeAllWidgets();
+
+        releaseFocusWhenEmpty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PopupLayer::mouseOnWidget(Vector2f pos) const
+    {
+        for (const auto& widget : m_widgets)
+        {
+            if (widget->isVisible() && widget->mouseOnWidget(pos))
+                return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PopupLayer::update(sf::Time elapsedTime)
+    {
+        // Close the popups of widgets that were destroyed or that were removed from the gui together with one of their parents
+        std::size_t i = m_widgets.size();
+        while (i-- > 0)
+        {
+            const Widget::Ptr owner = m_owners[i].lock();
+
+            const Widget* root = owner.get();
+            while (root && root->getParent())
+                root = root->getParent();
+
+            if (root != m_guiContainer)
+            {
+                const Widget::Ptr popup = m_widgets[i];
+                popup->setVisible(false);
+                remove(popup);
+            }
+        }
+
+        // The popups themselves are updated by the gui when they need it, like all other widgets inside the gui
+        Widget::update(elapsedTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PopupLayer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        drawWidgetContainer(&target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PopupLayer::releaseFocusWhenEmpty()
+    {
+        if (!m_widgets.empty())
+            return;
+
+        if (m_guiContainer->m_focusedWidget.get() == this)
+        {
+            m_guiContainer->m_focusedWidget = nullptr;
+            ++m_focusChangeCounter;
+        }
+
+        if (m_focused)
+            setFocused(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
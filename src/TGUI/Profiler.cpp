@@ -0,0 +1,400 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Widget.hpp>
+#include <TGUI/Exception.hpp>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        // Durations are stored in nanoseconds while recording, because many widgets are drawn in less than a microsecond
+        struct Durations
+        {
+            long long update = 0;
+            long long event = 0;
+            long long draw = 0;
+        };
+
+        struct OpenScope
+        {
+            Profiler::Category category;
+            const Widget* widget;
+            Clock::time_point start;
+            long long childDuration;
+        };
+
+        struct TraceEvent
+        {
+            const std::string* name;
+            Profiler::Category category;
+            const Widget* widget;
+            long long start;
+            long long duration;
+        };
+
+        struct WidgetDurations
+        {
+            const std::string* type;
+            Durations durations;
+            std::size_t calls = 0;
+        };
+
+        struct RecordedFrame
+        {
+            std::size_t frameNumber = 0;
+            Durations gui;
+            std::size_t drawCalls = 0;
+            std::size_t clippings = 0;
+            std::size_t glyphMisses = 0;
+            std::map<const Widget*, WidgetDurations> widgets;
+            std::vector<TraceEvent> events;
+            long long end = 0;
+        };
+
+        const Clock::time_point startTime = Clock::now();
+        std::size_t maxRecordedFrames = 120;
+        std::size_t nextFrameNumber = 0;
+        std::deque<RecordedFrame> recordedFrames;
+        RecordedFrame currentFrame;
+        std::vector<OpenScope> openScopes;
+
+        // The types of the widgets are stored only once, so that the trace events can point to them
+        std::set<std::string> widgetTypes;
+
+        const std::string guiUpdateName = "Gui::updateTime";
+        const std::string guiEventName = "Gui::handleEvent";
+        const std::string guiDrawName = "Gui::draw";
+
+        long long& getDuration(Durations& durations, Profiler::Category category)
+        {
+            switch (category)
+            {
+                case Profiler::Category::Update:
+                    return durations.update;
+                case Profiler::Category::Event:
+                    return durations.event;
+                case Profiler::Category::Draw:
+                default:
+                    return durations.draw;
+            }
+        }
+
+        const char* getCategoryName(Profiler::Category category)
+        {
+            switch (category)
+            {
+                case Profiler::Category::Update:
+                    return "update";
+                case Profiler::Category::Event:
+                    return "event";
+                case Profiler::Category::Draw:
+                default:
+                    return "draw";
+            }
+        }
+
+        const std::string* getGuiScopeName(Profiler::Category category)
+        {
+            switch (category)
+            {
+                case Profiler::Category::Update:
+                    return &guiUpdateName;
+                case Profiler::Category::Event:
+                    return &guiEventName;
+                case Profiler::Category::Draw:
+                default:
+                    return &guiDrawName;
+            }
+        }
+
+        Profiler::Times toTimes(const Durations& durations)
+        {
+            return {sf::microseconds(durations.update / 1000),
+                    sf::microseconds(durations.event / 1000),
+                    sf::microseconds(durations.draw / 1000)};
+        }
+
+        Profiler::FrameStats toFrameStats(const RecordedFrame& frame)
+        {
+            Profiler::FrameStats stats;
+            stats.frameNumber = frame.frameNumber;
+            stats.gui = toTimes(frame.gui);
+            stats.drawCalls = frame.drawCalls;
+            stats.clippings = frame.clippings;
+            stats.glyphMisses = frame.glyphMisses;
+
+            std::map<std::string, Durations> typeDurations;
+            for (const auto& pair : frame.widgets)
+            {
+                Profiler::WidgetStats& widgetStats = stats.widgets[pair.first];
+                widgetStats.type = *pair.second.type;
+                widgetStats.times = toTimes(pair.second.durations);
+                widgetStats.calls = pair.second.calls;
+
+                Durations& durations = typeDurations[*pair.second.type];
+                durations.update += pair.second.durations.update;
+                durations.event += pair.second.durations.event;
+                durations.draw += pair.second.durations.draw;
+            }
+
+            for (const auto& pair : typeDurations)
+                stats.widgetTypes[pair.first] = toTimes(pair.second);
+
+            return stats;
+        }
+
+        // Trace files use microseconds, but fractions are allowed
+        std::string toTraceTime(long long nanoseconds)
+        {
+            std::ostringstream stream;
+            stream << (nanoseconds / 1000) << '.';
+            stream.width(3);
+            stream.fill('0');
+            stream << (nanoseconds % 1000);
+            return stream.str();
+        }
+    }
+
+    bool Profiler::m_enabled = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isAvailable()
+    {
+    #ifdef TGUI_ENABLE_PROFILER
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isEnabled()
+    {
+        return m_enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setMaxRecordedFrames(std::size_t frames)
+    {
+        maxRecordedFrames = frames;
+        while (recordedFrames.size() > maxRecordedFrames)
+            recordedFrames.pop_front();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Profiler::getMaxRecordedFrames()
+    {
+        return maxRecordedFrames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Profiler::FrameStats> Profiler::getRecordedFrames()
+    {
+        std::vector<FrameStats> frames;
+        frames.reserve(recordedFrames.size());
+        for (const auto& frame : recordedFrames)
+            frames.push_back(toFrameStats(frame));
+
+        return frames;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::FrameStats Profiler::getLastFrame()
+    {
+        if (recordedFrames.empty())
+            return {};
+
+        return toFrameStats(recordedFrames.back());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::clear()
+    {
+        recordedFrames.clear();
+        currentFrame = {};
+        nextFrameNumber = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::saveChromeTrace(const std::string& filename)
+    {
+        std::ofstream file{filename};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the profiler trace to it."};
+
+        file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+
+        bool firstEvent = true;
+        for (const auto& frame : recordedFrames)
+        {
+            for (const auto& event : frame.events)
+            {
+                if (!firstEvent)
+                    file << ",\n";
+                firstEvent = false;
+
+                file << "{\"name\": \"" << *event.name << "\", \"cat\": \"" << getCategoryName(event.category)
+                     << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1, \"ts\": " << toTraceTime(event.start)
+                     << ", \"dur\": " << toTraceTime(event.duration);
+
+                if (event.widget)
+                    file << ", \"args\": {\"widget\": \"" << static_cast<const void*>(event.widget) << "\"}";
+
+                file << "}";
+            }
+
+            if (!firstEvent)
+                file << ",\n";
+            firstEvent = false;
+
+            file << "{\"name\": \"Frame " << frame.frameNumber << "\", \"cat\": \"frame\", \"ph\": \"i\", \"s\": \"g\", \"pid\": 1, \"tid\": 1, \"ts\": "
+                 << toTraceTime(frame.end) << ", \"args\": {\"drawCalls\": " << frame.drawCalls << ", \"clippings\": " << frame.clippings
+                 << ", \"glyphMisses\": " << frame.glyphMisses << "}}";
+        }
+
+        file << "\n]}\n";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::endFrame()
+    {
+        if (!m_enabled)
+            return;
+
+        currentFrame.frameNumber = nextFrameNumber++;
+        currentFrame.end = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+
+        if (maxRecordedFrames > 0)
+        {
+            recordedFrames.push_back(std::move(currentFrame));
+            while (recordedFrames.size() > maxRecordedFrames)
+                recordedFrames.pop_front();
+        }
+
+        currentFrame = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::addDrawCalls(std::size_t count)
+    {
+        if (m_enabled)
+            currentFrame.drawCalls += count;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::addClipping()
+    {
+        if (m_enabled)
+            ++currentFrame.clippings;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::addGlyphMiss()
+    {
+        if (m_enabled)
+            ++currentFrame.glyphMisses;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Scope::Scope(Category category, const Widget* widget) :
+        m_active{m_enabled}
+    {
+        if (m_active)
+            openScopes.push_back({category, widget, Clock::now(), 0});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Scope::~Scope()
+    {
+        if (!m_active)
+            return;
+
+        const OpenScope scope = openScopes.back();
+        openScopes.pop_back();
+
+        const Clock::time_point end = Clock::now();
+        const long long duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - scope.start).count();
+        if (!openScopes.empty())
+            openScopes.back().childDuration += duration;
+
+        // Nothing is recorded when the profiler was disabled while the scope was open
+        if (!m_enabled)
+            return;
+
+        const std::string* name;
+        if (scope.widget)
+        {
+            name = &*widgetTypes.insert(scope.widget->getWidgetType()).first;
+
+            WidgetDurations& widgetDurations = currentFrame.widgets[scope.widget];
+            widgetDurations.type = name;
+            getDuration(widgetDurations.durations, scope.category) += duration - scope.childDuration;
+            ++widgetDurations.calls;
+        }
+        else // The scope belongs to the gui itself
+        {
+            name = getGuiScopeName(scope.category);
+            getDuration(currentFrame.gui, scope.category) += duration;
+        }
+
+        const long long start = std::chrono::duration_cast<std::chrono::nanoseconds>(scope.start - startTime).count();
+        currentFrame.events.push_back({name, scope.category, scope.widget, start, duration});
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,386 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RecordingRenderTarget.hpp>
+#include <TGUI/DrawOpacity.hpp>
+#include <TGUI/Profiler.hpp>
+#include <SFML/Graphics/ConvexShape.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <iomanip>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Copies that are reused to draw shapes with an outline or texture and texts while the draw opacity is less than 1
+        sf::ConvexShape fadedShape;
+        sf::Text fadedText;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeColor(std::ostream& stream, const sf::Color& color)
+        {
+            stream << '#' << std::hex << std::setfill('0')
+                   << std::setw(2) << static_cast<unsigned int>(color.r)
+                   << std::setw(2) << static_cast<unsigned int>(color.g)
+                   << std::setw(2) << static_cast<unsigned int>(color.b)
+                   << std::setw(2) << static_cast<unsigned int>(color.a)
+                   << std::dec << std::setfill(' ');
+        }
+
+        void writePoint(std::ostream& stream, sf::Vector2f point)
+        {
+            stream << '(' << point.x << ',' << point.y << ')';
+        }
+
+        const char* getTypeName(RecordingRenderTarget::DrawCommand::Type type)
+        {
+            switch (type)
+            {
+                case RecordingRenderTarget::DrawCommand::Type::Vertices:
+                    return "Vertices";
+                case RecordingRenderTarget::DrawCommand::Type::Shape:
+                    return "Shape";
+                case RecordingRenderTarget::DrawCommand::Type::Text:
+                    return "Text";
+                case RecordingRenderTarget::DrawCommand::Type::Sprite:
+                default:
+                    return "Sprite";
+            }
+        }
+    }
+
+    unsigned int RecordingRenderTarget::m_recordingTargetCount = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RecordingRenderTarget::RecordingRenderTarget(sf::Vector2u size) :
+        m_size{size}
+    {
+        initialize();
+        ++m_recordingTargetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RecordingRenderTarget::~RecordingRenderTarget()
+    {
+        --m_recordingTargetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2u RecordingRenderTarget::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<RecordingRenderTarget::DrawCommand>& RecordingRenderTarget::getCommands() const
+    {
+        return m_commands;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::clearCommands()
+    {
+        m_commands.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string RecordingRenderTarget::toString() const
+    {
+        std::ostringstream stream;
+        stream << std::fixed << std::setprecision(2);
+
+        for (const auto& command : m_commands)
+        {
+            stream << getTypeName(command.type)
+                   << " clip=" << command.clipRect.left << ',' << command.clipRect.top << ',' << command.clipRect.width << ',' << command.clipRect.height;
+
+            if (command.texture)
+                stream << " texture=" << command.texture->getSize().x << 'x' << command.texture->getSize().y;
+            if (command.shader)
+                stream << " shader";
+            if (!(command.blendMode == sf::BlendAlpha))
+                stream << " blend=custom";
+
+            if (command.type == DrawCommand::Type::Text)
+            {
+                stream << " pos=";
+                writePoint(stream, command.transform.transformPoint({0, 0}));
+                stream << " size=" << command.characterSize << " style=" << command.style << " color=";
+                writeColor(stream, command.color);
+                stream << " text=\"" << command.string.toAnsiString() << '"';
+            }
+            else
+            {
+                stream << " primitive=" << static_cast<int>(command.primitiveType) << " vertices=";
+                for (const auto& vertex : command.vertices)
+                {
+                    writePoint(stream, command.transform.transformPoint(vertex.position));
+                    writeColor(stream, vertex.color);
+                    if (command.texture)
+                        writePoint(stream, vertex.texCoords);
+                }
+            }
+
+            if (command.outlineThickness != 0)
+            {
+                stream << " outline=" << command.outlineThickness << ' ';
+                writeColor(stream, command.outlineColor);
+            }
+
+            stream << '\n';
+        }
+
+        return stream.str();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RecordingRenderTarget* RecordingRenderTarget::getRecordingTarget(sf::RenderTarget& target)
+    {
+        if (m_recordingTargetCount == 0)
+            return nullptr;
+
+        return dynamic_cast<RecordingRenderTarget*>(&target);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::record(DrawCommand&& command, const sf::RenderStates& states)
+    {
+        command.transform = states.transform * command.transform;
+        command.blendMode = states.blendMode;
+        command.shader = states.shader;
+        if (!command.texture)
+            command.texture = states.texture;
+
+        command.clipRect = getViewport(getView());
+        m_commands.push_back(std::move(command));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+    bool RecordingRenderTarget::setActive(bool)
+#else
+    bool RecordingRenderTarget::activate(bool)
+#endif
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace priv
+    {
+        void drawVertices(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+        {
+            TGUI_PROFILE_DRAW_CALLS(1);
+
+            if (getDrawOpacity() < 1)
+                vertices = fadeVertices(vertices, vertexCount, states.blendMode);
+
+            RecordingRenderTarget* recordingTarget = RecordingRenderTarget::getRecordingTarget(target);
+            if (!recordingTarget)
+            {
+                target.draw(vertices, vertexCount, type, states);
+                return;
+            }
+
+            RecordingRenderTarget::DrawCommand command;
+            command.type = RecordingRenderTarget::DrawCommand::Type::Vertices;
+            command.primitiveType = type;
+            command.vertices.assign(vertices, vertices + vertexCount);
+            recordingTarget->record(std::move(command), states);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void drawShape(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states)
+        {
+            if (getDrawOpacity() < 1)
+            {
+                const float opacity = getDrawOpacity();
+
+                // Filled shapes without texture can be faded by drawing their points as a triangle fan
+                if ((shape.getOutlineThickness() == 0) && !shape.getTexture())
+                {
+                    sf::RenderStates shapeStates = states;
+                    shapeStates.transform *= shape.getTransform();
+
+                    // Draw the faded vertices without fading them again
+                    const sf::Vertex* vertices = fadeShape(shape, states.blendMode);
+                    setDrawOpacity(1);
+                    drawVertices(target, vertices, shape.getPointCount(), sf::PrimitiveType::TrianglesFan, shapeStates);
+                    setDrawOpacity(opacity);
+                    return;
+                }
+
+                // Other shapes are copied with faded colors, the texture coordinates only depend on the points and texture rect
+                fadedShape.setPointCount(shape.getPointCount());
+                for (std::size_t i = 0; i < shape.getPointCount(); ++i)
+                    fadedShape.setPoint(i, shape.getPoint(i));
+
+                fadedShape.setTexture(shape.getTexture());
+                fadedShape.setTextureRect(shape.getTextureRect());
+                fadedShape.setFillColor(applyDrawOpacity(shape.getFillColor(), states.blendMode));
+                fadedShape.setOutlineColor(applyDrawOpacity(shape.getOutlineColor(), states.blendMode));
+                fadedShape.setOutlineThickness(shape.getOutlineThickness());
+                fadedShape.setOrigin(shape.getOrigin());
+                fadedShape.setPosition(shape.getPosition());
+                fadedShape.setRotation(shape.getRotation());
+                fadedShape.setScale(shape.getScale());
+
+                // Draw the faded copy without fading it again
+                setDrawOpacity(1);
+                drawShape(target, fadedShape, states);
+                setDrawOpacity(opacity);
+                return;
+            }
+
+            TGUI_PROFILE_DRAW_CALLS(1);
+
+            RecordingRenderTarget* recordingTarget = RecordingRenderTarget::getRecordingTarget(target);
+            if (!recordingTarget)
+            {
+                target.draw(shape, states);
+                return;
+            }
+
+            RecordingRenderTarget::DrawCommand command;
+            command.type = RecordingRenderTarget::DrawCommand::Type::Shape;
+            command.primitiveType = sf::PrimitiveType::TrianglesFan;
+            command.transform = shape.getTransform();
+            command.texture = shape.getTexture();
+            command.outlineColor = shape.getOutlineColor();
+            command.outlineThickness = shape.getOutlineThickness();
+            for (std::size_t i = 0; i < shape.getPointCount(); ++i)
+                command.vertices.emplace_back(shape.getPoint(i), shape.getFillColor());
+
+            recordingTarget->record(std::move(command), states);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void drawText(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states)
+        {
+            if (getDrawOpacity() < 1)
+            {
+                // The copy is reused between calls, so that its string and vertices don't have to be reallocated every time
+                fadedText = text;
+            #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+                fadedText.setFillColor(applyDrawOpacity(text.getFillColor(), states.blendMode));
+                fadedText.setOutlineColor(applyDrawOpacity(text.getOutlineColor(), states.blendMode));
+            #else
+                fadedText.setColor(applyDrawOpacity(text.getColor(), states.blendMode));
+            #endif
+
+                // Draw the faded copy without fading it again
+                const float opacity = getDrawOpacity();
+                setDrawOpacity(1);
+                drawText(target, fadedText, states);
+                setDrawOpacity(opacity);
+                return;
+            }
+
+            TGUI_PROFILE_DRAW_CALLS(1);
+
+            RecordingRenderTarget* recordingTarget = RecordingRenderTarget::getRecordingTarget(target);
+            if (!recordingTarget)
+            {
+                target.draw(text, states);
+                return;
+            }
+
+            RecordingRenderTarget::DrawCommand command;
+            command.type = RecordingRenderTarget::DrawCommand::Type::Text;
+            command.transform = text.getTransform();
+            command.string = text.getString();
+            command.characterSize = text.getCharacterSize();
+            command.style = text.getStyle();
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            command.color = text.getFillColor();
+            command.outlineColor = text.getOutlineColor();
+            command.outlineThickness = text.getOutlineThickness();
+        #else
+            command.color = text.getColor();
+        #endif
+            recordingTarget->record(std::move(command), states);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void drawSprite(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states)
+        {
+            if (getDrawOpacity() < 1)
+            {
+                sf::Sprite fadedSprite = sprite;
+                fadedSprite.setColor(applyDrawOpacity(sprite.getColor(), states.blendMode));
+
+                // Draw the faded copy without fading it again
+                const float opacity = getDrawOpacity();
+                setDrawOpacity(1);
+                drawSprite(target, fadedSprite, states);
+                setDrawOpacity(opacity);
+                return;
+            }
+
+            TGUI_PROFILE_DRAW_CALLS(1);
+
+            RecordingRenderTarget* recordingTarget = RecordingRenderTarget::getRecordingTarget(target);
+            if (!recordingTarget)
+            {
+                target.draw(sprite, states);
+                return;
+            }
+
+            const sf::FloatRect bounds = sprite.getLocalBounds();
+            const sf::FloatRect texRect{sprite.getTextureRect()};
+
+            RecordingRenderTarget::DrawCommand command;
+            command.type = RecordingRenderTarget::DrawCommand::Type::Sprite;
+            command.primitiveType = sf::PrimitiveType::TrianglesStrip;
+            command.transform = sprite.getTransform();
+            command.texture = sprite.getTexture();
+            command.vertices = {{{0, 0}, sprite.getColor(), {texRect.left, texRect.top}},
+                                {{0, bounds.height}, sprite.getColor(), {texRect.left, texRect.top + texRect.height}},
+                                {{bounds.width, 0}, sprite.getColor(), {texRect.left + texRect.width, texRect.top}},
+                                {{bounds.width, bounds.height}, sprite.getColor(), {texRect.left + texRect.width, texRect.top + texRect.height}}};
+            recordingTarget->record(std::move(command), states);
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
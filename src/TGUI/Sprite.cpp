@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Sprite.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
 
@@ -95,8 +96,15 @@ namespace tgui
     {
         m_vertexColor = color;
 
+        if (!m_vertices)
+            return;
+
+        // Copies of the sprite may still be sharing the vertices
+        if (m_vertices.use_count() > 1)
+            m_vertices = std::make_shared<std::vector<sf::Vertex>>(*m_vertices);
+
         const sf::Color vertexColor = Color::calcColorOpacity(m_vertexColor, m_opacity);
-        for (auto& vertex : m_vertices)
+        for (auto& vertex : *m_vertices)
             vertex.color = vertexColor;
     }
 
@@ -140,7 +148,7 @@ namespace tgui
 
     bool Sprite::isTransparentPixel(Vector2f pos) const
     {
-        if (!isSet() || !m_texture.getData()->image || (m_size.x == 0) || (m_size.y == 0))
+        if (!isSet() || (!m_texture.getData()->image && m_texture.getData()->alphaMask.empty()) || (m_size.x == 0) || (m_size.y == 0))
             return true;
 
         if (getRotation() != 0)
@@ -257,8 +265,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Sprite::updateVertices()
+    void Sprite::updateVertices() const
     {
+        m_verticesForLoadingTexture = m_texture.getData()->loading;
+
+        // The vertices can't be reused when copies of the sprite are still sharing them
+        if (m_vertices.use_count() != 1)
+            m_vertices = std::make_shared<std::vector<sf::Vertex>>();
+
+        std::vector<sf::Vertex>& vertices = *m_vertices;
+
         // Figure out how the image is scaled best
         Vector2f textureSize{m_texture.getImageSize()};
         FloatRect middleRect{sf::FloatRect{m_texture.getMiddleRect()}};
@@ -304,11 +320,11 @@ namespace tgui
             // |   | //
             // 2---3 //
             ///////////
-            m_vertices.resize(4);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[3] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            vertices.resize(4);
+            vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
+            vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
+            vertices[2] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
+            vertices[3] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::Horizontal:
@@ -317,15 +333,15 @@ namespace tgui
             // |   |       |   | //
             // 1---3-------5---7 //
             ///////////////////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[2] = {{middleRect.left * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[3] = {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[4] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[5] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[6] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            vertices.resize(8);
+            vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
+            vertices[1] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
+            vertices[2] = {{middleRect.left * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left, 0}};
+            vertices[3] = {{middleRect.left * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
+            vertices[4] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
+            vertices[5] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
+            vertices[6] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
+            vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::Vertical:
@@ -340,15 +356,15 @@ namespace tgui
             // |   | //
             // 6---7-//
             ///////////
-            m_vertices.resize(8);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[2] = {{0, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            vertices.resize(8);
+            vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
+            vertices[1] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
+            vertices[2] = {{0, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top}};
+            vertices[3] = {{m_size.x, middleRect.top * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top}};
+            vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
+            vertices[5] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
+            vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
+            vertices[7] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
 
         case ScalingType::NineSlice:
@@ -363,29 +379,29 @@ namespace tgui
             // |    |              |     |  //
             // 6----7-------------8/20---21 //
             //////////////////////////////////
-            m_vertices.resize(22);
-            m_vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
-            m_vertices[1] = {{middleRect.left, 0}, m_vertexColor, {middleRect.left, 0}};
-            m_vertices[2] = {{0, middleRect.top}, m_vertexColor, {0, middleRect.top}};
-            m_vertices[3] = {{middleRect.left, middleRect.top}, m_vertexColor, {middleRect.left, middleRect.top}};
-            m_vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
-            m_vertices[5] = {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
-            m_vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
-            m_vertices[7] = {{middleRect.left, m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
-            m_vertices[8] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
-            m_vertices[9] = m_vertices[5];
-            m_vertices[10] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
-            m_vertices[11] = m_vertices[3];
-            m_vertices[12] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
-            m_vertices[13] = m_vertices[1];
-            m_vertices[14] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
-            m_vertices[15] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
-            m_vertices[16] = m_vertices[12];
-            m_vertices[17] = {{m_size.x, middleRect.top}, m_vertexColor, {textureSize.x, middleRect.top}};
-            m_vertices[18] = m_vertices[10];
-            m_vertices[19] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
-            m_vertices[20] = m_vertices[8];
-            m_vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
+            vertices.resize(22);
+            vertices[0] = {{0, 0}, m_vertexColor, {0, 0}};
+            vertices[1] = {{middleRect.left, 0}, m_vertexColor, {middleRect.left, 0}};
+            vertices[2] = {{0, middleRect.top}, m_vertexColor, {0, middleRect.top}};
+            vertices[3] = {{middleRect.left, middleRect.top}, m_vertexColor, {middleRect.left, middleRect.top}};
+            vertices[4] = {{0, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {0, middleRect.top + middleRect.height}};
+            vertices[5] = {{middleRect.left, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left, middleRect.top + middleRect.height}};
+            vertices[6] = {{0, m_size.y}, m_vertexColor, {0, textureSize.y}};
+            vertices[7] = {{middleRect.left, m_size.y}, m_vertexColor, {middleRect.left, textureSize.y}};
+            vertices[8] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y}, m_vertexColor, {middleRect.left + middleRect.width, textureSize.y}};
+            vertices[9] = vertices[5];
+            vertices[10] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top + middleRect.height}};
+            vertices[11] = vertices[3];
+            vertices[12] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), middleRect.top}, m_vertexColor, {middleRect.left + middleRect.width, middleRect.top}};
+            vertices[13] = vertices[1];
+            vertices[14] = {{m_size.x - (textureSize.x - middleRect.left - middleRect.width), 0}, m_vertexColor, {middleRect.left + middleRect.width, 0}};
+            vertices[15] = {{m_size.x, 0}, m_vertexColor, {textureSize.x, 0}};
+            vertices[16] = vertices[12];
+            vertices[17] = {{m_size.x, middleRect.top}, m_vertexColor, {textureSize.x, middleRect.top}};
+            vertices[18] = vertices[10];
+            vertices[19] = {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, m_vertexColor, {textureSize.x, middleRect.top + middleRect.height}};
+            vertices[20] = vertices[8];
+            vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
     }
@@ -407,6 +423,14 @@ namespace tgui
 
         if (isSet())
         {
+            // Nothing is drawn while the image is still being loaded in the background
+            if (m_texture.getData()->loading)
+                return;
+
+            // The size of the texture wasn't known yet when the vertices were last calculated
+            if (m_verticesForLoadingTexture || !m_vertices)
+                updateVertices();
+
             // Apply clipping when needed
         #ifdef TGUI_USE_CPP17
             std::optional<Clipping> clipping;
@@ -420,7 +444,7 @@ namespace tgui
 
             states.shader = m_texture.getData()->shader;
             states.texture = &m_texture.getData()->texture;
-            target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            priv::drawVertices(target, m_vertices->data(), m_vertices->size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
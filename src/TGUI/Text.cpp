@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Text.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 #include <TGUI/Global.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cmath>
@@ -34,6 +35,14 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    const std::shared_ptr<sf::Text>& Text::getEmptyText()
+    {
+        static const auto emptyText = std::make_shared<sf::Text>();
+        return emptyText;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Text::getSize() const
     {
         return m_size;
@@ -43,7 +52,7 @@ namespace tgui
 
     void Text::setString(const sf::String& string)
     {
-        m_text.setString(string);
+        getModifiableText().setString(string);
         recalculateSize();
     }
 
@@ -51,14 +60,14 @@ namespace tgui
 
     const sf::String& Text::getString() const
     {
-        return m_text.getString();
+        return m_text->getString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::setCharacterSize(unsigned int size)
     {
-        m_text.setCharacterSize(size);
+        getModifiableText().setCharacterSize(size);
         recalculateSize();
     }
 
@@ -66,7 +75,7 @@ namespace tgui
 
     unsigned int Text::getCharacterSize() const
     {
-        return m_text.getCharacterSize();
+        return m_text->getCharacterSize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,9 +85,9 @@ namespace tgui
         m_color = color;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
+        getModifiableText().setFillColor(Color::calcColorOpacity(color, m_opacity));
     #else
-        m_text.setColor(Color::calcColorOpacity(color, m_opacity));
+        getModifiableText().setColor(Color::calcColorOpacity(color, m_opacity));
     #endif
     }
 
@@ -96,9 +105,9 @@ namespace tgui
         m_opacity = opacity;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
+        getModifiableText().setFillColor(Color::calcColorOpacity(m_color, opacity));
     #else
-        m_text.setColor(Color::calcColorOpacity(m_color, opacity));
+        getModifiableText().setColor(Color::calcColorOpacity(m_color, opacity));
     #endif
     }
 
@@ -116,22 +125,24 @@ namespace tgui
         m_font = font;
 
         if (font)
-            m_text.setFont(*font.getFont());
+            getModifiableText().setFont(*font.getFont());
         else
         {
             // We can't keep using a pointer to the old font (it might be destroyed), but sf::Text has no function to pass an empty font
-            if (m_text.getFont())
+            if (m_text->getFont())
             {
-                m_text = sf::Text();
-                m_text.setString(getString());
-                m_text.setCharacterSize(getCharacterSize());
-                m_text.setStyle(getStyle());
+                auto text = std::make_shared<sf::Text>();
+                text->setString(getString());
+                text->setCharacterSize(getCharacterSize());
+                text->setStyle(getStyle());
 
             #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-                m_text.setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
+                text->setFillColor(Color::calcColorOpacity(getColor(), getOpacity()));
             #else
-                m_text.setColor(Color::calcColorOpacity(getColor(), getOpacity()));
+                text->setColor(Color::calcColorOpacity(getColor(), getOpacity()));
             #endif
+
+                m_text = std::move(text);
             }
         }
 
@@ -149,9 +160,9 @@ namespace tgui
 
     void Text::setStyle(TextStyle style)
     {
-        if (style != m_text.getStyle())
+        if (style != m_text->getStyle())
         {
-            m_text.setStyle(style);
+            getModifiableText().setStyle(style);
             recalculateSize();
         }
     }
@@ -160,14 +171,14 @@ namespace tgui
 
     TextStyle Text::getStyle() const
     {
-        return m_text.getStyle();
+        return m_text->getStyle();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return m_text.findCharacterPos(index);
+        return m_text->findCharacterPos(index);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,7 +193,17 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        priv::drawText(target, *m_text, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Text& Text::getModifiableText()
+    {
+        if (m_text.use_count() > 1)
+            m_text = std::make_shared<sf::Text>(*m_text);
+
+        return *m_text;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -200,9 +221,9 @@ namespace tgui
         float maxWidth = 0;
         unsigned int lines = 1;
         std::uint32_t prevChar = 0;
-        const sf::String& string = m_text.getString();
-        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
+        const sf::String& string = m_text->getString();
+        const bool bold = (m_text->getStyle() & sf::Text::Bold) != 0;
+        const unsigned int textSize = m_text->getCharacterSize();
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
             const float kerning = font->getKerning(prevChar, string[i], textSize);
@@ -213,15 +234,15 @@ namespace tgui
                 lines++;
             }
             else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+                width += (static_cast<float>(m_font.getGlyph(' ', textSize, bold).advance) * 4) + kerning;
             else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += static_cast<float>(m_font.getGlyph(string[i], textSize, bold).advance) + kerning;
 
             prevChar = string[i];
         }
 
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        const float height = lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
+        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text->getCharacterSize(), m_text->getStyle());
+        const float height = lines * font->getLineSpacing(m_text->getCharacterSize()) + extraVerticalSpace;
         m_size = {std::max(maxWidth, width), height};
     }
 
@@ -312,8 +333,8 @@ namespace tgui
 
         // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
         const float lineHeight = characterSize
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
+                                 + font.getGlyph('g', characterSize, bold).bounds.height
+                                 + font.getGlyph('g', characterSize, bold).bounds.top;
 
         // Get the line spacing sfml returns
         const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
@@ -348,9 +369,9 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
+                    charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
                 else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
+                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
 
                 const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
@@ -215,6 +215,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Texture::isLoading() const
+    {
+        return m_data && m_data->loading;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Texture::setSmooth(bool smooth)
     {
         if (m_data)
@@ -253,18 +260,28 @@ namespace tgui
 
     sf::IntRect Texture::getMiddleRect() const
     {
-        return m_middleRect;
+        // When the image is loaded asynchronously, its size may not have been known yet when the texture data was set
+        if ((m_middleRect == sf::IntRect{}) && m_data)
+            return {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+        else
+            return m_middleRect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Texture::isTransparentPixel(sf::Vector2u pixel) const
     {
-        if (!m_data || !m_data->image)
+        if (!m_data || (!m_data->image && m_data->alphaMask.empty()))
             return false;
 
         assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
 
+        if (!m_data->alphaMask.empty())
+        {
+            const unsigned int bit = (pixel.y * m_data->texture.getSize().x) + pixel.x;
+            return (m_data->alphaMask[bit / 32] & (1u << (bit % 32))) != 0;
+        }
+
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
         else
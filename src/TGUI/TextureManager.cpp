@@ -26,12 +26,213 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
+#include <condition_variable>
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <mutex>
+#include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    bool TextureManager::m_alphaMaskEnabled = false;
+    bool TextureManager::m_asyncLoadingEnabled = false;
+    std::size_t TextureManager::m_uploadBudget = 4 * 1024 * 1024;
+    std::size_t TextureManager::m_finishedAsyncLoadCount = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // Creates a mask with a bit for every pixel in the part of the image that was copied to the texture
+        void createAlphaMask(TextureData& data, const sf::IntRect& partRect)
+        {
+            const sf::Vector2u size = data.texture.getSize();
+            const unsigned int imageWidth = data.image->getSize().x;
+            const sf::Uint8* pixels = data.image->getPixelsPtr();
+
+            // The texture only contains the part of the rectangle that lies inside the image
+            const unsigned int left = static_cast<unsigned int>(std::max(partRect.left, 0));
+            const unsigned int top = static_cast<unsigned int>(std::max(partRect.top, 0));
+
+            data.alphaMask.assign((size.x * size.y + 31) / 32, 0);
+            for (unsigned int y = 0; y < size.y; ++y)
+            {
+                for (unsigned int x = 0; x < size.x; ++x)
+                {
+                    // Every pixel in the image has 4 components, the alpha value is stored in the last one
+                    if (pixels[(((top + y) * imageWidth) + left + x) * 4 + 3] == 0)
+                    {
+                        const unsigned int bit = (y * size.x) + x;
+                        data.alphaMask[bit / 32] |= (1u << (bit % 32));
+                    }
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the part of the image that ends up in the texture, the same way as sf::Texture::loadFromImage determines it
+        sf::IntRect getImagePart(const sf::Vector2u& imageSize, const sf::IntRect& partRect)
+        {
+            const int width = static_cast<int>(imageSize.x);
+            const int height = static_cast<int>(imageSize.y);
+            if ((partRect.width == 0) || (partRect.height == 0)
+             || ((partRect.left <= 0) && (partRect.top <= 0) && (partRect.width >= width) && (partRect.height >= height)))
+                return {0, 0, width, height};
+
+            sf::IntRect rect = partRect;
+            if (rect.left < 0)
+                rect.left = 0;
+            if (rect.top < 0)
+                rect.top = 0;
+            if (rect.left + rect.width > width)
+                rect.width = width - rect.left;
+            if (rect.top + rect.height > height)
+                rect.height = height - rect.top;
+
+            return rect;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Image that is being loaded for a texture while async loading is enabled
+        struct AsyncLoad
+        {
+            std::weak_ptr<TextureData> data;
+            std::string filename;
+            sf::IntRect partRect;
+            Texture::ImageLoaderFunc imageLoader;
+
+            std::unique_ptr<sf::Image> image;
+            unsigned int rowsUploaded = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Runs the image loaders on a background thread, which is only started when the first image is requested
+        class AsyncImageDecoder
+        {
+        public:
+            ~AsyncImageDecoder()
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_stopping = true;
+                }
+
+                m_requestAdded.notify_all();
+                if (m_thread.joinable())
+                    m_thread.join();
+            }
+
+            void request(AsyncLoad&& load)
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                m_requests.push_back(std::move(load));
+                m_requestAdded.notify_one();
+
+                if (!m_thread.joinable())
+                    m_thread = std::thread(&AsyncImageDecoder::run, this);
+            }
+
+            void takeDecoded(std::deque<AsyncLoad>& loads)
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                for (auto& load : m_decoded)
+                    loads.push_back(std::move(load));
+
+                m_decoded.clear();
+            }
+
+            void waitUntilIdle()
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                m_idle.wait(lock, [this]{ return m_requests.empty() && !m_busy; });
+            }
+
+            std::size_t getPendingCount()
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                return m_requests.size() + m_decoded.size() + (m_busy ? 1 : 0);
+            }
+
+        private:
+            void run()
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                while (true)
+                {
+                    m_requestAdded.wait(lock, [this]{ return m_stopping || !m_requests.empty(); });
+                    if (m_stopping)
+                        return;
+
+                    AsyncLoad load = std::move(m_requests.front());
+                    m_requests.pop_front();
+                    m_busy = true;
+                    lock.unlock();
+
+                    // There is no need to decode the image when all textures that used it were already destroyed
+                    if (!load.data.expired())
+                    {
+                        try
+                        {
+                            load.image = load.imageLoader(load.filename);
+                        }
+                        catch (...)
+                        {
+                            // Errors can't be reported, the texture will simply remain empty
+                        }
+                    }
+
+                    lock.lock();
+                    m_decoded.push_back(std::move(load));
+                    m_busy = false;
+                    m_idle.notify_all();
+                }
+            }
+
+        private:
+            std::thread m_thread;
+            std::mutex m_mutex;
+            std::condition_variable m_requestAdded;
+            std::condition_variable m_idle;
+            std::deque<AsyncLoad> m_requests;
+            std::deque<AsyncLoad> m_decoded;
+            bool m_busy = false;
+            bool m_stopping = false;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        AsyncImageDecoder& getAsyncImageDecoder()
+        {
+            static AsyncImageDecoder decoder;
+            return decoder;
+        }
+
+        // Decoded images that still have to be uploaded, only accessed from the thread that calls uploadDecodedImages
+        std::deque<AsyncLoad> pendingUploads;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Marks the texture as loaded and lets the widgets that use it know about the real size of the image
+        void finishLoading(TextureData& data)
+        {
+            data.loading = false;
+
+            // A callback could destroy a widget that is still waiting, which then removes its own callback from the texture
+            while (!data.loadedCallbacks.empty())
+            {
+                const std::function<void()> callback = std::move(data.loadedCallbacks.back().second);
+                data.loadedCallbacks.pop_back();
+                callback();
+            }
+        }
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -77,6 +278,20 @@ namespace tgui
 
         // Load the image
         auto data = imageIt->second.back().data;
+        if (m_asyncLoadingEnabled)
+        {
+            // The texture remains empty until uploadDecodedImages is called after the image was decoded in the background
+            AsyncLoad load;
+            load.data = data;
+            load.filename = filename;
+            load.partRect = partRect;
+            load.imageLoader = texture.getImageLoader();
+
+            data->loading = true;
+            getAsyncImageDecoder().request(std::move(load));
+            return data;
+        }
+
         data->image = texture.getImageLoader()(filename);
         if (data->image != nullptr)
         {
@@ -87,10 +302,17 @@ namespace tgui
             else
                 loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
 
-            if (loadFromImageSuccess)
-                return data;
-            else
+            if (!loadFromImageSuccess)
                 return nullptr;
+
+            // Only keep the information needed to check for transparent pixels when requested
+            if (m_alphaMaskEnabled)
+            {
+                createAlphaMask(*data, partRect);
+                data->image = nullptr;
+            }
+
+            return data;
         }
 
         // The image could not be loaded
@@ -149,6 +371,145 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAlphaMaskEnabled(bool enabled)
+    {
+        m_alphaMaskEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAlphaMaskEnabled()
+    {
+        return m_alphaMaskEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncLoadingEnabled(bool enabled)
+    {
+        m_asyncLoadingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAsyncLoadingEnabled()
+    {
+        return m_asyncLoadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setUploadBudget(std::size_t bytes)
+    {
+        m_uploadBudget = bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getUploadBudget()
+    {
+        return m_uploadBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::uploadDecodedImages(bool ignoreBudget)
+    {
+        getAsyncImageDecoder().takeDecoded(pendingUploads);
+
+        std::size_t budget = m_uploadBudget;
+        if (ignoreBudget || (budget == 0))
+            budget = std::numeric_limits<std::size_t>::max();
+
+        bool texturesFinished = false;
+        std::vector<sf::Uint8> rowBuffer;
+        while (!pendingUploads.empty() && (budget > 0))
+        {
+            AsyncLoad& load = pendingUploads.front();
+            const auto data = load.data.lock();
+            if (!data)
+            {
+                pendingUploads.pop_front();
+                continue;
+            }
+
+            const sf::IntRect rect = load.image ? getImagePart(load.image->getSize(), load.partRect) : sf::IntRect{};
+            if ((rect.width <= 0) || (rect.height <= 0)
+             || ((load.rowsUploaded == 0) && !data->texture.create(static_cast<unsigned int>(rect.width), static_cast<unsigned int>(rect.height))))
+            {
+                // The image could not be loaded, the texture remains empty
+                pendingUploads.pop_front();
+                finishLoading(*data);
+                texturesFinished = true;
+                ++m_finishedAsyncLoadCount;
+                continue;
+            }
+
+            // Upload as many rows as the budget allows, but always at least one
+            const unsigned int width = static_cast<unsigned int>(rect.width);
+            const unsigned int height = static_cast<unsigned int>(rect.height);
+            const std::size_t rowSize = static_cast<std::size_t>(width) * 4;
+            const unsigned int rows = static_cast<unsigned int>(std::min<std::size_t>(height - load.rowsUploaded, std::max<std::size_t>(budget / rowSize, 1)));
+
+            const unsigned int imageWidth = load.image->getSize().x;
+            const sf::Uint8* pixels = load.image->getPixelsPtr() + ((static_cast<std::size_t>(rect.top + load.rowsUploaded) * imageWidth) + rect.left) * 4;
+            if (width != imageWidth)
+            {
+                // The rows of a part of the image aren't stored next to each other
+                rowBuffer.resize(rows * rowSize);
+                for (unsigned int row = 0; row < rows; ++row)
+                    std::copy(pixels + row * imageWidth * 4, pixels + row * imageWidth * 4 + rowSize, rowBuffer.begin() + row * rowSize);
+
+                pixels = rowBuffer.data();
+            }
+
+            data->texture.update(pixels, width, rows, 0, load.rowsUploaded);
+            load.rowsUploaded += rows;
+            budget -= std::min(budget, rows * rowSize);
+
+            if (load.rowsUploaded == height)
+            {
+                data->image = std::move(load.image);
+                if (m_alphaMaskEnabled)
+                {
+                    createAlphaMask(*data, load.partRect);
+                    data->image = nullptr;
+                }
+
+                pendingUploads.pop_front();
+                finishLoading(*data);
+                texturesFinished = true;
+                ++m_finishedAsyncLoadCount;
+            }
+        }
+
+        return texturesFinished;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getFinishedAsyncLoadCount()
+    {
+        return m_finishedAsyncLoadCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getPendingAsyncLoadCount()
+    {
+        return getAsyncImageDecoder().getPendingCount() + pendingUploads.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::finishAsyncLoading()
+    {
+        getAsyncImageDecoder().waitUntilIdle();
+        uploadDecodedImages(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
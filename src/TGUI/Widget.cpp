@@ -24,12 +24,19 @@
 
 
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
+#include <TGUI/DrawOpacity.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Animation.hpp>
+#include <TGUI/MemoryUsage.hpp>
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <algorithm>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -37,28 +44,8 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    namespace
-    {
-        void addAnimation(std::vector<std::shared_ptr<priv::Animation>>& existingAnimations, std::shared_ptr<priv::Animation> newAnimation)
-        {
-            const auto type = newAnimation->getType();
-
-            // If another animation is already running with the same type then instantly finish it
-            unsigned int i = 0;
-            while (i < existingAnimations.size())
-            {
-                if (existingAnimations[i]->getType() == type)
-                {
-                    existingAnimations[i]->finish();
-                    existingAnimations.erase(existingAnimations.begin() + i);
-                }
-                else
-                    ++i;
-            }
-
-            existingAnimations.push_back(newAnimation);
-        }
-    }
+    unsigned int Widget::m_focusChangeCounter = 0;
+    unsigned int Widget::m_focusableWidgetsChangeCounter = 0;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -80,6 +67,8 @@ namespace tgui
 
         for (auto& layout : m_boundSizeLayouts)
             layout->unbindWidget();
+
+        stopWaitingForTextures();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,8 +89,10 @@ namespace tgui
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {other.m_showAnimations},
+        m_updateNeeded                 {other.m_updateNeeded},
         m_fontCached                   {other.m_fontCached},
-        m_opacityCached                {other.m_opacityCached}
+        m_opacityCached                {other.m_opacityCached},
+        m_cachedAsBitmap               {other.m_cachedAsBitmap}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -109,6 +100,8 @@ namespace tgui
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
         m_renderer->subscribe(this, m_rendererChangedCallback);
+
+        waitForTexturesOf(other);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,8 +132,11 @@ namespace tgui
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
+        m_updateNeeded                 {std::move(other.m_updateNeeded)},
         m_fontCached                   {std::move(other.m_fontCached)},
-        m_opacityCached                {std::move(other.m_opacityCached)}
+        m_opacityCached                {std::move(other.m_opacityCached)},
+        m_cachedAsBitmap               {std::move(other.m_cachedAsBitmap)},
+        m_cachedBitmap                 {std::move(other.m_cachedBitmap)}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -151,6 +147,9 @@ namespace tgui
         m_renderer->subscribe(this, m_rendererChangedCallback);
 
         other.m_renderer = nullptr;
+
+        waitForTexturesOf(other);
+        other.stopWaitingForTextures();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -188,8 +187,11 @@ namespace tgui
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_showAnimations       = {};
+            m_updateNeeded         = other.m_updateNeeded;
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
+            m_cachedAsBitmap       = other.m_cachedAsBitmap;
+            m_cachedBitmapOutdated = true;
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -197,6 +199,9 @@ namespace tgui
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
             m_renderer->subscribe(this, m_rendererChangedCallback);
+
+            stopWaitingForTextures();
+            waitForTexturesOf(other);
         }
 
         return *this;
@@ -237,8 +242,12 @@ namespace tgui
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
             m_showAnimations       = std::move(other.m_showAnimations);
+            m_updateNeeded         = std::move(other.m_updateNeeded);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
+            m_cachedAsBitmap       = std::move(other.m_cachedAsBitmap);
+            m_cachedBitmapOutdated = true;
+            m_cachedBitmap         = std::move(other.m_cachedBitmap);
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -248,6 +257,10 @@ namespace tgui
             m_renderer->subscribe(this, m_rendererChangedCallback);
 
             other.m_renderer = nullptr;
+
+            stopWaitingForTextures();
+            waitForTexturesOf(other);
+            other.stopWaitingForTextures();
         }
 
         return *this;
@@ -303,6 +316,11 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        for (auto& pair : rendererData->propertyValuePairs)
+            waitForTexturesInProperty(pair.first, pair.second);
+
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -364,6 +382,10 @@ namespace tgui
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
+            // The cached bitmap of the widget itself remains valid when it is moved, only the parent has to be redrawn
+            if (m_parent)
+                m_parent->invalidateCachedBitmap();
+
             for (auto& layout : m_boundPositionLayouts)
                 layout->recalculateValue();
         }
@@ -381,6 +403,7 @@ namespace tgui
         {
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
+            invalidateCachedBitmap();
 
             for (auto& layout : m_boundSizeLayouts)
                 layout->recalculateValue();
@@ -421,21 +444,21 @@ namespace tgui
         {
             case ShowAnimationType::Fade:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, getInheritedOpacity(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                addAnimation(std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, m_inheritedOpacity, duration, [=]{onAnimationFinished.emit(this, type, true); }));
                 setInheritedOpacity(0);
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
+                addAnimation(std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                 setPosition(getPosition() + (getSize() / 2.f));
                 setSize(0, 0);
                 break;
             }
             case ShowAnimationType::SlideFromLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                 setPosition({-getFullSize().x, getPosition().y});
                 break;
             }
@@ -443,7 +466,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                    addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                     setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
                 }
                 else
@@ -455,7 +478,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideFromTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                 setPosition({getPosition().x, -getFullSize().y});
                 break;
             }
@@ -463,7 +486,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
+                    addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
                     setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
                 }
                 else
@@ -487,15 +510,15 @@ namespace tgui
         {
             case ShowAnimationType::Fade:
             {
-                float opacity = getInheritedOpacity();
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), getInheritedOpacity(), 0.f, duration,
+                float opacity = m_inheritedOpacity;
+                addAnimation(std::make_shared<priv::FadeAnimation>(shared_from_this(), m_inheritedOpacity, 0.f, duration,
                     [=](){ setVisible(false); setInheritedOpacity(opacity); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
+                addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
+                addAnimation(std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
                     [=](){ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
@@ -503,7 +526,7 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
+                    addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
                         [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 }
                 else
@@ -513,7 +536,7 @@ namespace tgui
             }
             case ShowAnimationType::SlideToLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
+                addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
                     [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
@@ -521,17 +544,17 @@ namespace tgui
             {
                 if (getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
+                    addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
                         [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 }
-                else
+                else
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToBottom) does not work before widget has a parent.");
 
                 break;
             }
             case ShowAnimationType::SlideToTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
+                addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
                     [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
                 break;
             }
@@ -540,9 +563,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::moveWithAnimation(Vector2f position, sf::Time duration, EasingType easing)
+    {
+        addAnimation(std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition(), position, duration, nullptr, easing));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::resizeWithAnimation(Vector2f size, sf::Time duration, EasingType easing)
+    {
+        addAnimation(std::make_shared<priv::ResizeAnimation>(shared_from_this(), getSize(), size, duration, nullptr, easing));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::fadeWithAnimation(float opacity, sf::Time duration, EasingType easing)
+    {
+        addAnimation(std::make_shared<priv::FadeAnimation>(shared_from_this(), m_inheritedOpacity, opacity, duration, nullptr, easing));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::animateRendererColor(const std::string& property, Color color, sf::Time duration, EasingType easing)
+    {
+        ObjectConverter value = getSharedRenderer()->getProperty(property);
+        const Color startColor = (value.getType() == ObjectConverter::Type::Color) ? value.getColor() : color;
+
+        addAnimation(std::make_shared<priv::ColorAnimation>(shared_from_this(), property, startColor, color, duration, nullptr, easing));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setVisible(bool visible)
     {
-        m_visible = visible;
+        if (m_visible != visible)
+        {
+            m_visible = visible;
+            ++m_focusableWidgetsChangeCounter;
+            invalidateCachedBitmap();
+        }
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -553,7 +612,12 @@ namespace tgui
 
     void Widget::setEnabled(bool enabled)
     {
-        m_enabled = enabled;
+        if (m_enabled != enabled)
+        {
+            m_enabled = enabled;
+            ++m_focusableWidgetsChangeCounter;
+            invalidateCachedBitmap();
+        }
 
         if (!enabled)
         {
@@ -570,6 +634,9 @@ namespace tgui
         if (m_focused == focused)
             return;
 
+        ++m_focusChangeCounter;
+        invalidateCachedBitmap();
+
         if (focused)
         {
             if (canGainFocus())
@@ -617,6 +684,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("font");
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -632,13 +700,19 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("opacity");
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float Widget::getInheritedOpacity() const
     {
-        return m_inheritedOpacity;
+        // The opacity of the parents isn't stored in the widget, it is only applied while drawing
+        float opacity = m_inheritedOpacity;
+        for (const Widget* parent = m_parent; parent != nullptr; parent = parent->m_parent)
+            opacity *= parent->m_opacityCached;
+
+        return opacity;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -657,6 +731,55 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setCachedAsBitmap(bool cached)
+    {
+        if (m_cachedAsBitmap == cached)
+            return;
+
+        m_cachedAsBitmap = cached;
+        m_cachedBitmapOutdated = true;
+
+        if (!cached)
+        {
+            // The render texture can be reused by other widgets in the same gui
+            if (auto guiContainer = findGuiContainer())
+                guiContainer->releaseRenderTexture(m_cachedBitmap);
+            else
+                m_cachedBitmap = nullptr;
+        }
+
+        if (m_parent)
+            m_parent->invalidateCachedBitmap();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isCachedAsBitmap() const
+    {
+        return m_cachedAsBitmap;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateCachedBitmap()
+    {
+        // The bitmaps of all parents that are being cached contain this widget, so they have to be redrawn as well
+        Widget* root = this;
+        for (Widget* widget = this; widget != nullptr; widget = widget->m_parent)
+        {
+            if (widget->m_cachedAsBitmap)
+                widget->m_cachedBitmapOutdated = true;
+
+            root = widget;
+        }
+
+        // The gui itself also has to be redrawn
+        if (auto guiContainer = dynamic_cast<GuiContainer*>(root))
+            guiContainer->requestRedraw();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Widget::canGainFocus() const
     {
         return m_enabled && m_visible;
@@ -680,6 +803,12 @@ namespace tgui
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
+
+        // Animations of widgets inside a gui are advanced by the gui, other widgets advance them in the update function
+        if (parent)
+            scheduleAnimations(findAnimationScheduler());
+        else if (m_animationScheduler)
+            m_animationScheduler->remove(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -688,6 +817,14 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
+        if (!m_animationScheduler)
+            updateAnimations(elapsedTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateAnimations(sf::Time elapsedTime)
+    {
         for (unsigned int i = 0; i < m_showAnimations.size();)
         {
             if (m_showAnimations[i]->update(elapsedTime))
@@ -699,6 +836,102 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::addAnimation(std::shared_ptr<priv::Animation> animation)
+    {
+        // If another animation is already changing the same property then instantly finish it
+        unsigned int i = 0;
+        while (i < m_showAnimations.size())
+        {
+            if (m_showAnimations[i]->changesSameProperty(*animation))
+            {
+                m_showAnimations[i]->finish();
+                m_showAnimations.erase(m_showAnimations.begin() + i);
+            }
+            else
+                ++i;
+        }
+
+        m_showAnimations.push_back(std::move(animation));
+
+        if (!m_animationScheduler)
+        {
+            if (auto scheduler = findAnimationScheduler())
+                scheduler->add(shared_from_this());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    priv::AnimationScheduler* Widget::findAnimationScheduler() const
+    {
+        if (auto guiContainer = findGuiContainer())
+            return &guiContainer->getAnimationScheduler();
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GuiContainer* Widget::findGuiContainer() const
+    {
+        if (!m_parent)
+            return nullptr;
+
+        Container* root = m_parent;
+        while (root->getParent())
+            root = root->getParent();
+
+        return dynamic_cast<GuiContainer*>(root);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::scheduleRedraw(sf::Time delay) const
+    {
+        if (auto guiContainer = findGuiContainer())
+            guiContainer->requestRedraw(delay);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::setUpdateNeeded(bool updateNeeded)
+    {
+        m_updateNeeded = updateNeeded;
+
+        // The scheduler drops the widget by itself once it no longer needs to be updated
+        if (updateNeeded)
+        {
+            if (auto scheduler = findAnimationScheduler())
+                scheduler->addUpdatedWidget(shared_from_this());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::scheduleAnimations(priv::AnimationScheduler* scheduler)
+    {
+        if (m_animationScheduler && (m_animationScheduler != scheduler))
+            m_animationScheduler->remove(this);
+
+        // When the widget isn't inside a gui, its animations (and those of its children) are advanced by the update function
+        if (!scheduler)
+            return;
+
+        if (!m_showAnimations.empty())
+            scheduler->add(shared_from_this());
+
+        if (m_updateNeeded)
+            scheduler->addUpdatedWidget(shared_from_this());
+
+        if (m_containerWidget)
+        {
+            for (const auto& child : static_cast<Container*>(this)->getWidgets())
+                child->scheduleAnimations(scheduler);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(Vector2f)
     {
     }
@@ -829,7 +1062,7 @@ namespace tgui
     {
         if (property == "opacity")
         {
-            m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+            m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
         }
         else if (property == "font")
         {
@@ -993,6 +1226,7 @@ namespace tgui
     {
         m_mouseHover = true;
         onMouseEnter.emit(this);
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1001,6 +1235,7 @@ namespace tgui
     {
         m_mouseHover = false;
         onMouseLeave.emit(this);
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1008,6 +1243,177 @@ namespace tgui
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+        invalidateCachedBitmap();
+
+        auto& propertyValuePairs = m_renderer->getData()->propertyValuePairs;
+        const auto it = propertyValuePairs.find(property);
+        if (it != propertyValuePairs.end())
+            waitForTexturesInProperty(property, it->second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::textureLoaded(const std::string& property)
+    {
+        rendererChangedCallback(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::waitForTexture(const Texture& texture, const std::string& property)
+    {
+        if (texture.isLoading())
+            waitForTextureData(texture.getData(), property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::waitForTexturesInProperty(const std::string& property, ObjectConverter& value)
+    {
+        // Textures that are still stored as a string haven't been loaded by the widget yet
+        if (value.getType() == ObjectConverter::Type::Texture)
+            waitForTexture(value.getTexture(), property);
+        else if (value.getType() == ObjectConverter::Type::RendererData)
+        {
+            for (auto& pair : value.getRenderer()->propertyValuePairs)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::Texture)
+                    waitForTexture(pair.second.getTexture(), property);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::waitForTextureData(const std::shared_ptr<TextureData>& data, const std::string& property)
+    {
+        for (const auto& loadingTexture : m_loadingTextures)
+        {
+            if ((loadingTexture.first.lock() == data) && (loadingTexture.second == property))
+                return;
+        }
+
+        m_loadingTextures.emplace_back(data, property);
+
+        const TextureData* loadedData = data.get();
+        data->loadedCallbacks.emplace_back(this, [this,loadedData,property]{
+            m_loadingTextures.erase(std::remove_if(m_loadingTextures.begin(), m_loadingTextures.end(),
+                [loadedData,&property](const std::pair<std::weak_ptr<TextureData>, std::string>& loadingTexture){
+                    return (loadingTexture.first.lock().get() == loadedData) && (loadingTexture.second == property);
+                }), m_loadingTextures.end());
+
+            textureLoaded(property);
+        });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::waitForTexturesOf(const Widget& other)
+    {
+        for (const auto& loadingTexture : other.m_loadingTextures)
+        {
+            const auto data = loadingTexture.first.lock();
+            if (data && data->loading)
+                waitForTextureData(data, loadingTexture.second);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::stopWaitingForTextures()
+    {
+        for (const auto& loadingTexture : m_loadingTextures)
+        {
+            if (const auto data = loadingTexture.first.lock())
+            {
+                data->loadedCallbacks.erase(std::remove_if(data->loadedCallbacks.begin(), data->loadedCallbacks.end(),
+                    [this](const std::pair<const void*, std::function<void()>>& callback){ return callback.first == this; }),
+                    data->loadedCallbacks.end());
+            }
+        }
+
+        m_loadingTextures.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::drawCachedBitmap(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        const Vector2f offset = getPosition() + getWidgetOffset();
+        const sf::Vector2u size{static_cast<unsigned int>(std::ceil(std::max(0.f, getFullSize().x))),
+                                static_cast<unsigned int>(std::ceil(std::max(0.f, getFullSize().y)))};
+        if ((size.x == 0) || (size.y == 0))
+            return;
+
+        if (!m_cachedBitmap || (m_cachedBitmap->getSize().x < size.x) || (m_cachedBitmap->getSize().y < size.y))
+        {
+            // The texture pool belongs to the gui, so that no render textures are kept alive after the gui is destroyed
+            if (auto guiContainer = findGuiContainer())
+            {
+                guiContainer->releaseRenderTexture(m_cachedBitmap);
+                m_cachedBitmap = guiContainer->acquireRenderTexture(size);
+            }
+            else
+            {
+                m_cachedBitmap = std::make_unique<sf::RenderTexture>();
+                if (!m_cachedBitmap->create(size.x, size.y))
+                    m_cachedBitmap = nullptr;
+            }
+
+            m_cachedBitmapOutdated = true;
+
+            // Draw the widget directly when no render texture could be created
+            if (!m_cachedBitmap)
+            {
+                draw(target, states);
+                return;
+            }
+        }
+
+        if (m_cachedBitmapOutdated)
+        {
+            m_cachedBitmap->clear(sf::Color::Transparent);
+            m_cachedBitmap->setView(m_cachedBitmap->getDefaultView());
+
+            // Clipping inside the widget has to be calculated relative to the texture instead of the gui view
+            const sf::View guiView = Clipping::getGuiView();
+            Clipping::setGuiView(m_cachedBitmap->getView());
+
+            // The opacity of the parents is applied when drawing the bitmap, so it shouldn't end up inside the texture
+            const float drawOpacity = priv::getDrawOpacity();
+            priv::setDrawOpacity(1);
+
+            sf::RenderStates textureStates;
+            textureStates.transform.translate(-offset);
+            draw(*m_cachedBitmap, textureStates);
+
+            priv::setDrawOpacity(drawOpacity);
+            Clipping::setGuiView(guiView);
+            m_cachedBitmap->display();
+            m_cachedBitmapOutdated = false;
+        }
+
+        // The colors in the texture were already blended with the alpha channel, so they can't be multiplied with it again
+        sf::RenderStates spriteStates = states;
+        spriteStates.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+        sf::Sprite sprite{m_cachedBitmap->getTexture(), {0, 0, static_cast<int>(size.x), static_cast<int>(size.y)}};
+        sprite.setPosition(offset);
+        priv::drawSprite(target, sprite, spriteStates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::reportMemoryUsage(MemoryUsage& usage) const
+    {
+        usage.addWidgetBytes(sizeof(Widget) + m_type.capacity());
+        usage.addRendererData(m_renderer->getData());
+
+        if (m_toolTip)
+            usage.addWidget(*m_toolTip);
+
+        if (m_cachedBitmap)
+            usage.addTextureGpuBytes(static_cast<std::size_t>(m_cachedBitmap->getSize().x) * m_cachedBitmap->getSize().y * 4);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1024,7 +1430,25 @@ namespace tgui
         else
             shape.setFillColor(color);
 
-        target.draw(shape, states);
+        priv::drawShape(target, shape, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::drawTriangle(sf::RenderTarget& target,
+                              const sf::RenderStates& states,
+                              Vector2f point1,
+                              Vector2f point2,
+                              Vector2f point3,
+                              Color color) const
+    {
+        const sf::Vertex vertices[] = {
+            {point1, color},
+            {point2, color},
+            {point3, color}
+        };
+
+        priv::drawVertices(target, vertices, 3, sf::PrimitiveType::Triangles, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1043,7 +1467,7 @@ namespace tgui
             sf::RectangleShape border;
             border.setFillColor(color);
             border.setSize({size.x, size.y});
-            target.draw(border, states);
+            priv::drawShape(target, border, states);
         }
         else // Draw borders in the normal way
         {
@@ -1070,7 +1494,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            priv::drawVertices(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
@@ -41,7 +41,7 @@ namespace tgui
 
     BitmapButton::Ptr BitmapButton::create()
     {
-        return std::make_shared<BitmapButton>();
+        return makePooled<BitmapButton>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +70,7 @@ namespace tgui
         m_string = text;
         m_text.setString(text);
         m_text.setCharacterSize(m_textSize);
+        invalidateCachedBitmap();
 
         if (m_autoSize)
             updateSize();
@@ -82,6 +83,10 @@ namespace tgui
         m_glyphTexture = image;
         m_glyphSprite.setTexture(m_glyphTexture);
         updateSize();
+        invalidateCachedBitmap();
+
+        // The glyph is given its size once the image has finished loading
+        waitForTexture(m_glyphTexture, "image");
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +102,7 @@ namespace tgui
     {
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,9 +240,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BitmapButton::textureLoaded(const std::string& property)
+    {
+        if (property == "image")
+        {
+            updateSize();
+            invalidateCachedBitmap();
+        }
+        else
+            Button::textureLoaded(property);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BitmapButton::recalculateGlyphSize()
     {
-        if (!m_glyphSprite.isSet())
+        if (!m_glyphSprite.isSet() || m_glyphTexture.isLoading())
             return;
 
         if (m_relativeGlyphHeight == 0)
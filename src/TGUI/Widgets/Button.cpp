@@ -46,7 +46,7 @@ namespace tgui
 
     Button::Ptr Button::create(const sf::String& text)
     {
-        auto button = std::make_shared<Button>();
+        auto button = makePooled<Button>();
 
         if (!text.isEmpty())
             button->setText(text);
@@ -116,6 +116,7 @@ namespace tgui
     {
         m_string = text;
         m_text.setString(text);
+        invalidateCachedBitmap();
 
         // Set the text size when the text has a fixed size
         if (m_textSize != 0)
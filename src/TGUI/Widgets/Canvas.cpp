@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -87,7 +88,7 @@ namespace tgui
 
     Canvas::Ptr Canvas::create(Layout2d size)
     {
-        return std::make_shared<Canvas>(size);
+        return makePooled<Canvas>(size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -142,6 +143,9 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+
+        // The contents of the canvas only become visible once they are displayed
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,7 +163,7 @@ namespace tgui
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        priv::drawSprite(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/MemoryUsage.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -52,7 +53,7 @@ namespace tgui
 
     ChatBox::Ptr ChatBox::create()
     {
-        return std::make_shared<ChatBox>();
+        return makePooled<ChatBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,7 +269,10 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         if (m_linesStartFromTop != startFromTop)
+        {
             m_linesStartFromTop = startFromTop;
+            invalidateCachedBitmap();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,9 +338,15 @@ namespace tgui
 
         // Pass the event to the scrollbar when the mouse is on top of it or when we are dragging its thumb
         if (((m_scroll->isMouseDown()) && (m_scroll->isMouseDownOnThumb())) || m_scroll->mouseOnWidget(pos - getPosition()))
-            m_scroll->mouseMoved(pos - getPosition());
+        {
+            if (m_scroll->mouseMovedOnScrollbar(pos - getPosition()))
+                invalidateCachedBitmap();
+        }
         else
-            m_scroll->mouseNoLongerOnWidget();
+        {
+            if (m_scroll->mouseNoLongerOnScrollbar())
+                invalidateCachedBitmap();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,6 +423,23 @@ namespace tgui
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
             }
         }
+
+        invalidateCachedBitmap();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::reportMemoryUsage(MemoryUsage& usage) const
+    {
+        Widget::reportMemoryUsage(usage);
+
+        for (const auto& line : m_lines)
+        {
+            usage.addText(line.text);
+            usage.addString(line.string);
+        }
+
+        usage.addWidget(*m_scroll);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
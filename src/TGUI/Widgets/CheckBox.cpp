@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -48,7 +49,7 @@ namespace tgui
 
     CheckBox::Ptr CheckBox::create(sf::String text)
     {
-        auto checkBox = std::make_shared<CheckBox>();
+        auto checkBox = makePooled<CheckBox>();
 
         if (!text.isEmpty())
             checkBox->setText(text);
@@ -165,7 +166,8 @@ namespace tgui
 
     void CheckBox::updateTextureSizes()
     {
-        if (m_spriteUnchecked.isSet() && m_spriteChecked.isSet())
+        if (m_spriteUnchecked.isSet() && m_spriteChecked.isSet()
+         && !m_textureUncheckedCached.isLoading() && !m_textureCheckedCached.isLoading())
         {
             m_spriteUnchecked.setSize(getInnerSize());
             m_spriteChecked.setSize(
@@ -257,7 +259,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                priv::drawVertices(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
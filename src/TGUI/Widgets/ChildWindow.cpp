@@ -69,13 +69,17 @@ namespace tgui
                 if (!onClose.emit(this))
                     destroy();
             });
+
+        // The title bar buttons aren't part of the container, so the window has to be redrawn when they change
+        for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+            button->connect({"MouseEntered", "MouseLeft"}, [this](){ invalidateCachedBitmap(); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ChildWindow::Ptr ChildWindow::create(const sf::String& title, unsigned int titleButtons)
     {
-        return std::make_shared<ChildWindow>(title, titleButtons);
+        return makePooled<ChildWindow>(title, titleButtons);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -251,6 +255,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -270,6 +275,8 @@ namespace tgui
             m_titleText.setCharacterSize(m_titleTextSize);
         else
             m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, m_titleBarHeightCached * 0.8f));
+
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,6 +294,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -670,7 +678,8 @@ namespace tgui
         {
             if (button->isVisible())
             {
-                if (m_spriteTitleBar.isSet() && (button->getSharedRenderer()->getTexture().getData() != nullptr))
+                if (m_spriteTitleBar.isSet() && (button->getSharedRenderer()->getTexture().getData() != nullptr)
+                 && !m_spriteTitleBar.getTexture().isLoading() && !button->getSharedRenderer()->getTexture().isLoading())
                 {
                     button->setSize(button->getSharedRenderer()->getTexture().getImageSize().x * (m_titleBarHeightCached / m_spriteTitleBar.getTexture().getImageSize().y),
                                     button->getSharedRenderer()->getTexture().getImageSize().y * (m_titleBarHeightCached / m_spriteTitleBar.getTexture().getImageSize().y));
@@ -688,6 +697,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
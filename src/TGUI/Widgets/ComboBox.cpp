@@ -24,9 +24,11 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
+#include <TGUI/PopupLayer.hpp>
 #include <TGUI/Clipping.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
+#include <TGUI/MemoryUsage.hpp>
 #include <TGUI/SignalImpl.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,7 +163,7 @@ namespace tgui
 
     ComboBox::Ptr ComboBox::create()
     {
-        return std::make_shared<ComboBox>();
+        return makePooled<ComboBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,7 +223,8 @@ namespace tgui
             updateListBoxHeight();
         }
 
-        if (m_spriteArrow.isSet())
+        // The size of the arrow image is unknown while it is still being loaded
+        if (m_spriteArrow.isSet() && !m_spriteArrow.getTexture().isLoading())
         {
             m_spriteArrow.setSize({m_spriteArrow.getTexture().getImageSize().x * (height / m_spriteArrow.getTexture().getImageSize().y), height});
             m_spriteArrowHover.setSize(m_spriteArrow.getSize());
@@ -269,6 +272,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateCachedBitmap();
         return ret;
     }
 
@@ -278,6 +282,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItemById(id);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateCachedBitmap();
         return ret;
     }
 
@@ -287,6 +292,7 @@ namespace tgui
     {
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateCachedBitmap();
         return ret;
     }
 
@@ -295,6 +301,7 @@ namespace tgui
     void ComboBox::deselectItem()
     {
         m_text.setString("");
+        invalidateCachedBitmap();
         m_listBox->deselectItem();
     }
 
@@ -307,6 +314,7 @@ namespace tgui
         const bool ret = m_listBox->removeItem(itemName);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateCachedBitmap();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -336,6 +344,7 @@ namespace tgui
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateCachedBitmap();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -349,6 +358,7 @@ namespace tgui
     void ComboBox::removeAllItems()
     {
         m_text.setString("");
+        invalidateCachedBitmap();
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
@@ -388,6 +398,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateCachedBitmap();
         return ret;
     }
 
@@ -397,6 +408,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateCachedBitmap();
         return ret;
     }
 
@@ -406,6 +418,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateCachedBitmap();
         return ret;
     }
 
@@ -443,6 +456,7 @@ namespace tgui
     {
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -566,6 +580,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::reportMemoryUsage(MemoryUsage& usage) const
+    {
+        Widget::reportMemoryUsage(usage);
+
+        usage.addText(m_text);
+        usage.addWidget(*m_listBox);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::rendererChanged(const std::string& property)
     {
         if (property == "borders")
@@ -777,17 +801,24 @@ namespace tgui
         {
             m_listBox->setVisible(true);
 
-            // Find the GuiContainer that contains the combo box
-            Container* container = getParent();
-            while (container->getParent() != nullptr)
-                container = container->getParent();
-
             if (m_expandDirection == ExpandDirection::Down)
                 m_listBox->setPosition({getAbsolutePosition().x, getAbsolutePosition().y + getSize().y - m_bordersCached.getBottom()});
             else // if (m_expandDirection == ExpandDirection::Up)
                 m_listBox->setPosition({getAbsolutePosition().x, getAbsolutePosition().y - m_listBox->getSize().y + m_bordersCached.getTop()});
 
-            container->add(m_listBox, "#TGUI_INTERNAL$ComboBoxListBox#");
+            // Inside a gui the list is shown as a popup, so that the widgets of the gui don't have to change
+            if (GuiContainer* guiContainer = findGuiContainer())
+                guiContainer->getPopupLayer()->openPopup(m_listBox, shared_from_this());
+            else
+            {
+                // Find the root container that contains the combo box
+                Container* container = getParent();
+                while (container->getParent() != nullptr)
+                    container = container->getParent();
+
+                container->add(m_listBox, "#TGUI_INTERNAL$ComboBoxListBox#");
+            }
+
             m_listBox->setFocused(true);
         }
     }
@@ -802,13 +833,9 @@ namespace tgui
             m_listBox->setVisible(false);
             m_listBox->mouseNoLongerOnWidget();
 
-            // Find the GuiContainer in order to remove the ListBox from it
-            Widget* container = this;
-            while (container->getParent() != nullptr)
-                container = container->getParent();
-
-            if (container != this)
-                static_cast<Container*>(container)->remove(m_listBox);
+            // Remove the list from the popup layer or from the root container to which it was added
+            if (m_listBox->getParent())
+                m_listBox->getParent()->remove(m_listBox);
         }
     }
 
@@ -820,6 +847,7 @@ namespace tgui
 
         m_listBox->connect("ItemSelected", [this](){
                                                 m_text.setString(m_listBox->getSelectedItem());
+                                                invalidateCachedBitmap();
                                                 onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
                                             });
 
@@ -874,17 +902,8 @@ namespace tgui
             else
                 drawRectangleShape(target, states, {arrowSize, arrowSize}, m_arrowBackgroundColorCached);
 
-            sf::ConvexShape arrow{3};
-            arrow.setPoint(0, {arrowSize / 5, arrowSize / 5});
-            arrow.setPoint(1, {arrowSize / 2, arrowSize * 4/5});
-            arrow.setPoint(2, {arrowSize * 4/5, arrowSize / 5});
-
-            if (m_mouseHover && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(m_arrowColorHoverCached);
-            else
-                arrow.setFillColor(m_arrowColorCached);
-
-            target.draw(arrow, states);
+            const Color arrowColor = (m_mouseHover && m_arrowColorHoverCached.isSet()) ? m_arrowColorHoverCached : m_arrowColorCached;
+            drawTriangle(target, states, {arrowSize / 5, arrowSize / 5}, {arrowSize / 2, arrowSize * 4/5}, {arrowSize * 4/5, arrowSize / 5}, arrowColor);
         }
 
         // Draw the selected item
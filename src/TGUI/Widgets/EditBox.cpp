@@ -27,6 +27,7 @@
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/MemoryUsage.hpp>
 
 /// TODO: Where m_selStart and m_selEnd are compared, use std::min and std::max and merge the if and else bodies
 
@@ -68,7 +69,7 @@ namespace tgui
 
     EditBox::Ptr EditBox::create()
     {
-        return std::make_shared<EditBox>();
+        return makePooled<EditBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,6 +147,8 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        invalidateCachedBitmap();
+
         // Check if the text is auto sized
         if (m_textSize == 0)
         {
@@ -165,10 +168,8 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
+        if (m_inputValidator.validate(text))
             m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
         else // Clear the text
             m_text = "";
 
@@ -187,6 +188,8 @@ namespace tgui
         else
             m_textFull.setString(m_text);
 
+        invalidateCharacterPositions();
+
         // Set the texts
         m_textBeforeSelection.setString(m_textFull.getString());
         m_textSelection.setString("");
@@ -199,14 +202,20 @@ namespace tgui
         const float width = getVisibleEditBoxWidth();
         if (m_limitTextWidth)
         {
-            // Now check if the text fits into the EditBox
-            while (!m_textFull.getString().isEmpty() && (getFullTextWidth() > width))
+            // Now check how many characters fit into the EditBox
+            const float textOffset = Text::getExtraHorizontalPadding(m_textFull);
+            std::size_t fittingChars = m_textFull.getString().getSize();
+            while ((fittingChars > 0) && (getCharacterPosition(fittingChars) + (2 * textOffset) > width))
+                --fittingChars;
+
+            // The text doesn't fit inside the EditBox, so the last characters must be deleted.
+            if (fittingChars < m_textFull.getString().getSize())
             {
-                // The text doesn't fit inside the EditBox, so the last character must be deleted.
                 sf::String displayedString = m_textFull.getString();
-                displayedString.erase(displayedString.getSize()-1);
+                displayedString.erase(fittingChars, sf::String::InvalidPos);
                 m_textFull.setString(displayedString);
-                m_text.erase(m_text.getSize()-1);
+                m_text.erase(fittingChars, sf::String::InvalidPos);
+                invalidateCharacterPositions(fittingChars);
             }
 
             m_textBeforeSelection.setString(m_textFull.getString());
@@ -242,6 +251,7 @@ namespace tgui
     void EditBox::setDefaultText(const sf::String& text)
     {
         m_defaultText.setString(text);
+        invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -309,6 +319,7 @@ namespace tgui
     {
         // Set the new character limit ( 0 to disable the limit )
         m_maxChars = maxChars;
+        invalidateCachedBitmap();
 
         // If there is a character limit then check if it is exceeded
         if ((m_maxChars > 0) && (m_textFull.getString().getSize() > m_maxChars))
@@ -324,6 +335,7 @@ namespace tgui
             m_textSelection.setString("");
             m_textAfterSelection.setString("");
             m_textFull.setString(displayedText);
+            invalidateCharacterPositions(m_maxChars);
 
             // Set the caret behind the last character
             setCaretPosition(displayedText.getSize());
@@ -357,6 +369,7 @@ namespace tgui
     void EditBox::limitTextWidth(bool limitWidth)
     {
         m_limitTextWidth = limitWidth;
+        invalidateCachedBitmap();
 
         if (!m_fontCached)
             return;
@@ -366,12 +379,18 @@ namespace tgui
         {
             // Delete the last characters when the text no longer fits inside the edit box
             const float width = getVisibleEditBoxWidth();
-            while (!m_textFull.getString().isEmpty() && (getFullTextWidth() > width))
+            const float textOffset = Text::getExtraHorizontalPadding(m_textFull);
+            std::size_t fittingChars = m_textFull.getString().getSize();
+            while ((fittingChars > 0) && (getCharacterPosition(fittingChars) + (2 * textOffset) > width))
+                --fittingChars;
+
+            if (fittingChars < m_textFull.getString().getSize())
             {
                 sf::String displayedString = m_textFull.getString();
-                displayedString.erase(displayedString.getSize()-1);
+                displayedString.erase(fittingChars, sf::String::InvalidPos);
                 m_textFull.setString(displayedString);
-                m_text.erase(m_text.getSize()-1);
+                m_text.erase(fittingChars, sf::String::InvalidPos);
+                invalidateCharacterPositions(fittingChars);
             }
 
             m_textBeforeSelection.setString(m_textFull.getString());
@@ -431,8 +450,9 @@ namespace tgui
 
     void EditBox::setInputValidator(const std::string& regex)
     {
-        m_regexString = regex;
-        m_regex = m_regexString;
+        m_inputValidator = InputValidator{regex};
+        m_validatorStates.assign(1, m_inputValidator.getStartState());
+        m_validValidatorStates = 1;
 
         setText(m_text);
     }
@@ -441,7 +461,7 @@ namespace tgui
 
     const std::string& EditBox::getInputValidator() const
     {
-        return m_regexString;
+        return m_inputValidator.getPattern();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,6 +472,7 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            setUpdateNeeded(true);
         }
         else // Unfocusing
         {
@@ -521,6 +542,7 @@ namespace tgui
 
             // If the next click comes soon enough then it will be a double click
             m_possibleDoubleClick = true;
+            setUpdateNeeded(true);
         }
 
         // Set the mouse down flag
@@ -548,6 +570,7 @@ namespace tgui
         if (m_mouseDown)
         {
             const auto oldSelEnd = m_selEnd;
+            const auto oldTextCropPosition = m_textCropPosition;
 
             // Check if there is a text width limit
             if (m_limitTextWidth)
@@ -602,6 +625,9 @@ namespace tgui
 
             if (m_selEnd != oldSelEnd)
                 updateSelection();
+
+            if ((m_selEnd != oldSelEnd) || (m_textCropPosition != oldTextCropPosition))
+                invalidateCachedBitmap();
         }
     }
 
@@ -744,6 +770,7 @@ namespace tgui
                     displayedString.erase(m_selEnd-1, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd-1, 1);
+                    invalidateCharacterPositions(m_selEnd-1);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd - 1);
@@ -783,6 +810,7 @@ namespace tgui
                     displayedString.erase(m_selEnd, 1);
                     m_textFull.setString(displayedString);
                     m_text.erase(m_selEnd, 1);
+                    invalidateCharacterPositions(m_selEnd);
 
                     // Set the caret back on the correct position
                     setCaretPosition(m_selEnd);
@@ -878,22 +906,29 @@ namespace tgui
             return;
 
         // Only add the character when the regex matches
-        if (m_regexString != ".*")
+        if (!m_inputValidator.acceptsEverything())
         {
-            sf::String text = m_text;
+            const std::size_t pos = std::min(m_selStart, m_selEnd);
+            if (m_inputValidator.isIncremental())
+            {
+                // The state in front of the caret is cached, so only the new character and the ones behind it are checked
+                InputValidator::State state = m_inputValidator.advance(getValidatorState(pos), key);
+                for (std::size_t i = pos + m_selChars; (i < m_text.getSize()) && (state != InputValidator::DeadState); ++i)
+                    state = m_inputValidator.advance(state, m_text[i]);
 
-            if (m_selChars == 0)
-                text.insert(m_selEnd, key);
+                if (!m_inputValidator.isAccepting(state))
+                    return;
+            }
             else
             {
-                const std::size_t pos = std::min(m_selStart, m_selEnd);
+                sf::String text = m_text;
                 text.erase(pos, m_selChars);
                 text.insert(pos, key);
-            }
 
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
+                // The character has to match the regex
+                if (!m_inputValidator.validate(text))
+                    return;
+            }
         }
 
         // If there are selected characters then delete them first
@@ -915,6 +950,7 @@ namespace tgui
             displayedText.insert(m_selEnd, key);
 
         m_textFull.setString(displayedText);
+        invalidateCharacterPositions(m_selEnd);
 
         // When there is a text width limit then reverse what we just did
         if (m_limitTextWidth)
@@ -926,6 +962,7 @@ namespace tgui
                 m_text.erase(m_selEnd, 1);
                 displayedText.erase(m_selEnd, 1);
                 m_textFull.setString(displayedText);
+                invalidateCharacterPositions(m_selEnd);
                 return;
             }
         }
@@ -954,6 +991,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::reportMemoryUsage(MemoryUsage& usage) const
+    {
+        Widget::reportMemoryUsage(usage);
+
+        usage.addString(m_text);
+        usage.addWidgetBytes(m_charPositions.capacity() * sizeof(float)
+                             + m_validatorStates.capacity() * sizeof(InputValidator::State));
+
+        usage.addText(m_textBeforeSelection);
+        usage.addText(m_textSelection);
+        usage.addText(m_textAfterSelection);
+        usage.addText(m_defaultText);
+        usage.addText(m_textFull);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::rendererChanged(const std::string& property)
     {
         if (property == "borders")
@@ -1010,6 +1064,9 @@ namespace tgui
             m_textAfterSelection.setStyle(style);
             m_textSelection.setStyle(style);
             m_textFull.setStyle(style);
+
+            // Bold text has wider characters
+            invalidateCharacterPositions();
         }
         else if (property == "defaulttextstyle")
         {
@@ -1228,44 +1285,90 @@ namespace tgui
             }
         }
 
-        float width = 0;
-        std::uint32_t prevChar = 0;
+        const std::size_t textLength = m_textFull.getString().getSize();
+        if (!m_fontCached || (textLength == 0))
+            return 0;
+
+        // Find the first character of which the right side is not located on the left of the mouse
+        updateCharacterPositions(textLength);
+        const auto it = std::lower_bound(m_charPositions.begin() + 1, m_charPositions.begin() + textLength + 1, posX);
+        if (it == m_charPositions.begin() + textLength + 1)
+            return textLength;
+
+        // If the mouse is on the second halve of the character then the caret should be on the right of it
+        const std::size_t index = static_cast<std::size_t>(it - m_charPositions.begin()) - 1;
+        if (posX - m_charPositions[index] > (m_charPositions[index + 1] - m_charPositions[index]) / 2.f)
+            return index + 1;
+        else
+            return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float EditBox::getCharacterPosition(std::size_t index)
+    {
+        if (!m_fontCached)
+            return 0;
+
+        index = std::min(index, m_textFull.getString().getSize());
+        updateCharacterPositions(index);
+        return m_charPositions[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::invalidateCharacterPositions(std::size_t firstChangedIndex)
+    {
+        // The offset in front of a character only depends on the characters that come before it
+        m_validCharPositions = std::min(m_validCharPositions, firstChangedIndex + 1);
+        m_charPositions.resize(m_textFull.getString().getSize() + 1);
+
+        // The same goes for the state of the input validator
+        m_validValidatorStates = std::min(m_validValidatorStates, firstChangedIndex + 1);
+        m_validatorStates.resize(m_text.getSize() + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::updateCharacterPositions(std::size_t lastIndex)
+    {
+        if (m_validCharPositions > lastIndex)
+            return;
+
+        const sf::String& displayedText = m_textFull.getString();
         const unsigned int textSize = getTextSize();
         const bool bold = (m_textFull.getStyle() & sf::Text::Bold) != 0;
 
-        std::size_t index;
-        for (index = 0; index < m_text.getSize(); ++index)
+        for (std::size_t i = m_validCharPositions; i <= lastIndex; ++i)
         {
             float charWidth;
-            std::uint32_t curChar = m_text[index];
+            const std::uint32_t curChar = displayedText[i-1];
+            const std::uint32_t prevChar = (i > 1) ? displayedText[i-2] : 0;
             if (curChar == '\n')
-            {
-                // This should not happen as edit box is for single line text, but lets try the next line anyway since we haven't found the position yet
-                width = 0;
-                prevChar = 0;
-                continue;
-            }
+                charWidth = 0; // This should not happen as edit box is for single line text
             else if (curChar == '\t')
                 charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
             else
                 charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
 
-            const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize);
-            if (width + charWidth < posX)
-                width += charWidth + kerning;
-            else
-            {
-                // If the mouse is on the second halve of the character then the caret should be on the right of it
-                if (width + charWidth - posX < charWidth / 2.f)
-                    index++;
+            m_charPositions[i] = m_charPositions[i-1] + m_fontCached.getKerning(prevChar, curChar, textSize) + charWidth;
+        }
 
-                break;
-            }
+        m_validCharPositions = lastIndex + 1;
+    }
 
-            prevChar = curChar;
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::State EditBox::getValidatorState(std::size_t index)
+    {
+        index = std::min(index, m_text.getSize());
+        if (m_validatorStates.size() < m_text.getSize() + 1)
+            m_validatorStates.resize(m_text.getSize() + 1);
 
-        return index;
+        for (; m_validValidatorStates <= index; ++m_validValidatorStates)
+            m_validatorStates[m_validValidatorStates] = m_inputValidator.advance(m_validatorStates[m_validValidatorStates-1], m_text[m_validValidatorStates-1]);
+
+        return m_validatorStates[index];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1283,6 +1386,7 @@ namespace tgui
         displayedString.erase(pos, m_selChars);
         m_textFull.setString(displayedString);
         m_text.erase(pos, m_selChars);
+        invalidateCharacterPositions(pos);
 
         // Set the caret back on the correct position
         setCaretPosition(pos);
@@ -1333,31 +1437,35 @@ namespace tgui
         // Check if there is a selection
         if (m_selChars != 0)
         {
+            const sf::String& displayedText = m_textFull.getString();
+            const std::size_t selectionStart = std::min(m_selStart, m_selEnd);
+            const std::size_t selectionEnd = std::max(m_selStart, m_selEnd);
+
             // Watch out for the kerning
-            if (m_textBeforeSelection.getString().getSize() > 0)
-                textX += m_fontCached.getKerning(m_textFull.getString()[m_textBeforeSelection.getString().getSize() - 1], m_textFull.getString()[m_textBeforeSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+            float kerningSelectionStart = 0;
+            if (selectionStart > 0)
+                kerningSelectionStart = m_fontCached.getKerning(displayedText[selectionStart - 1], displayedText[selectionStart], m_textFull.getCharacterSize());
 
-            textX += m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x;
+            float kerningSelectionEnd = 0;
+            if (selectionEnd < displayedText.getSize())
+                kerningSelectionEnd = m_fontCached.getKerning(displayedText[selectionEnd - 1], displayedText[selectionEnd], m_textFull.getCharacterSize());
+
+            const float selectionLeft = textX + getCharacterPosition(selectionStart) + kerningSelectionStart;
 
             // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_selectedTextBackground.setSize({m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x,
+            m_selectedTextBackground.setSize({getCharacterPosition(selectionEnd) - getCharacterPosition(selectionStart) - kerningSelectionStart,
                                               getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
-            m_selectedTextBackground.setPosition({textX, m_paddingCached.getTop()});
+            m_selectedTextBackground.setPosition({selectionLeft, m_paddingCached.getTop()});
 
             // Set the text selected text on the correct position
-            m_textSelection.setPosition(textX, textY);
-
-            // Watch out for kerning
-            if (m_textFull.getString().getSize() > m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize())
-                textX += m_fontCached.getKerning(m_textFull.getString()[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize() - 1], m_textFull.getString()[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+            m_textSelection.setPosition(selectionLeft, textY);
 
-            // Set the text selected text on the correct position
-            textX += m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x;
-            m_textAfterSelection.setPosition(textX, textY);
+            // Set the text after the selection on the correct position
+            m_textAfterSelection.setPosition(textX + getCharacterPosition(selectionEnd) + kerningSelectionEnd, textY);
         }
 
         // Set the position of the caret
-        caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
+        caretLeft += getCharacterPosition(m_selEnd) - (m_caret.getSize().x * 0.5f);
         m_caret.setPosition({caretLeft, m_paddingCached.getTop()});
     }
 
@@ -1365,6 +1473,8 @@ namespace tgui
 
     void EditBox::updateSelection()
     {
+        invalidateCachedBitmap();
+
         // Check if we are selecting text from left to right
         if (m_selEnd > m_selStart)
         {
@@ -1404,7 +1514,7 @@ namespace tgui
         if (!m_limitTextWidth)
         {
             // Find out the position of the caret
-            const float caretPosition = m_textFull.findCharacterPos(m_selEnd).x;
+            const float caretPosition = getCharacterPosition(m_selEnd);
 
             // If the caret is too far on the right then adjust the cropping
             if (m_textCropPosition + getVisibleEditBoxWidth() - (2 * Text::getExtraHorizontalPadding(m_textFull)) < caretPosition)
@@ -1456,7 +1566,16 @@ namespace tgui
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
+
+            if (m_focused)
+                invalidateCachedBitmap();
         }
+
+        // The caret is only drawn when the widget is focused
+        if (m_focused)
+            scheduleRedraw(sf::milliseconds(500) - m_animationTimeElapsed);
+        else if (!m_possibleDoubleClick)
+            setUpdateNeeded(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/Grid.hpp>
 #include <TGUI/SignalImpl.hpp>
+#include <TGUI/DrawOpacity.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -135,7 +136,7 @@ namespace tgui
 
     Grid::Ptr Grid::create()
     {
-        return std::make_shared<Grid>();
+        return makePooled<Grid>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -775,6 +776,13 @@ namespace tgui
     {
         states.transform.translate(getPosition());
 
+        // The opacity of the grid is applied to the widgets while drawing them
+        const float drawOpacity = priv::getDrawOpacity();
+        if (drawOpacity * m_opacityCached <= 0)
+            return;
+
+        priv::setDrawOpacity(drawOpacity * m_opacityCached);
+
         // Draw all widgets
         for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
         {
@@ -787,6 +795,8 @@ namespace tgui
                 }
             }
         }
+
+        priv::setDrawOpacity(drawOpacity);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -46,7 +46,7 @@ namespace tgui
 
     Group::Ptr Group::create(const Layout2d& size)
     {
-        return std::make_shared<Group>(size);
+        return makePooled<Group>(size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
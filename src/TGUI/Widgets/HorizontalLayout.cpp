@@ -45,7 +45,7 @@ namespace tgui
 
     HorizontalLayout::Ptr HorizontalLayout::create(const Layout2d& size)
     {
-        return std::make_shared<HorizontalLayout>(size);
+        return makePooled<HorizontalLayout>(size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
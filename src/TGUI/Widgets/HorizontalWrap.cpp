@@ -44,7 +44,7 @@ namespace tgui
 
     HorizontalWrap::Ptr HorizontalWrap::create(const Layout2d& size)
     {
-        return std::make_shared<HorizontalWrap>(size);
+        return makePooled<HorizontalWrap>(size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
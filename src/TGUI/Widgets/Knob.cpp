@@ -24,7 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
-#include <SFML/Graphics/CircleShape.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,7 +55,7 @@ namespace tgui
 
     Knob::Ptr Knob::create()
     {
-        return std::make_shared<Knob>();
+        return makePooled<Knob>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,7 +104,8 @@ namespace tgui
 
         m_bordersCached.updateParentSize(getSize());
 
-        if (m_spriteBackground.isSet() && m_spriteForeground.isSet())
+        if (m_spriteBackground.isSet() && m_spriteForeground.isSet()
+         && !m_spriteBackground.getTexture().isLoading() && !m_spriteForeground.getTexture().isLoading())
         {
             m_spriteBackground.setSize(getInnerSize());
             m_spriteForeground.setSize({m_spriteForeground.getTexture().getImageSize().x / m_spriteBackground.getTexture().getImageSize().x * getInnerSize().x,
@@ -427,6 +428,8 @@ namespace tgui
 
     void Knob::recalculateRotation()
     {
+        invalidateCachedBitmap();
+
         // Calculate the difference in degrees between the start and end rotation
         float allowedAngle = 0;
         if (compareFloats(m_startRotation, m_endRotation))
@@ -572,11 +575,11 @@ namespace tgui
         {
             states.transform.translate({borderThickness, borderThickness});
 
-            sf::CircleShape bordersShape{size / 2};
-            bordersShape.setFillColor(Color::Transparent);
-            bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
-            bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            m_bordersShape.setRadius(size / 2);
+            m_bordersShape.setFillColor(Color::Transparent);
+            m_bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
+            m_bordersShape.setOutlineThickness(borderThickness);
+            m_bordersShape.draw(target, states);
         }
 
         // Draw the background
@@ -584,9 +587,9 @@ namespace tgui
             m_spriteBackground.draw(target, states);
         else
         {
-            sf::CircleShape background{size / 2};
-            background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            m_backgroundShape.setRadius(size / 2);
+            m_backgroundShape.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+            m_backgroundShape.draw(target, states);
         }
 
         // Draw the foreground
@@ -604,11 +607,12 @@ namespace tgui
         }
         else
         {
-            sf::CircleShape thumb{size / 10.0f};
-            thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
-            thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
-                               (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            // Only the position of the thumb changes when the knob is turned, so the circle itself doesn't have to be rebuilt
+            m_thumbShape.setRadius(size / 10.0f);
+            m_thumbShape.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
+            states.transform.translate({(size / 2.0f) - m_thumbShape.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
+                                        (size / 2.0f) - m_thumbShape.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
+            m_thumbShape.draw(target, states);
         }
     }
 
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/MemoryUsage.hpp>
 
 #include <cmath>
 
@@ -52,7 +53,7 @@ namespace tgui
 
     Label::Ptr Label::create(sf::String text)
     {
-        auto label = std::make_shared<Label>();
+        auto label = makePooled<Label>();
 
         if (!text.isEmpty())
             label->setText(text);
@@ -116,7 +117,11 @@ namespace tgui
 
     void Label::setText(const sf::String& string)
     {
+        if (m_string == string)
+            return;
+
         m_string = string;
+        m_linesOutdated = true;
         rearrangeText();
     }
 
@@ -134,6 +139,7 @@ namespace tgui
         if (size != m_textSize)
         {
             m_textSize = size;
+            m_linesOutdated = true;
             rearrangeText();
         }
     }
@@ -264,6 +270,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                setUpdateNeeded(true);
             }
         }
     }
@@ -280,6 +287,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::reportMemoryUsage(MemoryUsage& usage) const
+    {
+        Widget::reportMemoryUsage(usage);
+
+        usage.addString(m_string);
+        for (const auto& line : m_lines)
+            usage.addText(line);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rendererChanged(const std::string& property)
     {
         if (property == "borders")
@@ -297,6 +315,7 @@ namespace tgui
         else if (property == "textstyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
+            m_linesOutdated = true;
             rearrangeText();
         }
         else if (property == "textcolor")
@@ -316,6 +335,7 @@ namespace tgui
         else if (property == "font")
         {
             Widget::rendererChanged(property);
+            m_linesOutdated = true;
             rearrangeText();
         }
         else if (property == "opacity")
@@ -410,16 +430,24 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+
+        // The time only has to be tracked while waiting for a second click
+        if (!m_possibleDoubleClick)
+            setUpdateNeeded(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Label::rearrangeText()
     {
-        m_lines.clear();
+        invalidateCachedBitmap();
 
         if (m_fontCached == nullptr)
+        {
+            m_lines.clear();
+            m_linesOutdated = true;
             return;
+        }
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached);
 
@@ -431,37 +459,20 @@ namespace tgui
         {
             maxWidth = getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight() - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2*textOffset;
             if (maxWidth <= 0)
+            {
+                m_lines.clear();
+                m_linesOutdated = true;
                 return;
+            }
         }
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
+        // The word wrapping only has to be redone when something changed that influences the result
+        if (m_linesOutdated || (maxWidth != m_linesMaxWidth))
+            updateLines(maxWidth);
 
-        // Split the string in multiple lines
         float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
-        {
-            newLinePos = string.find('\n', searchPosStart);
-
-            m_lines.emplace_back();
-            m_lines.back().setCharacterSize(getTextSize());
-            m_lines.back().setFont(m_fontCached);
-            m_lines.back().setStyle(m_textStyleCached);
-            m_lines.back().setColor(m_textColorCached);
-            m_lines.back().setOpacity(m_opacityCached);
-
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.back().setString(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.back().setString(string.substring(searchPosStart));
-
-            if (m_lines.back().getSize().x > width)
-                width = m_lines.back().getSize().x;
-
-            searchPosStart = newLinePos + 1;
-        }
+        for (const auto& line : m_lines)
+            width = std::max(width, line.getSize().x);
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
@@ -532,6 +543,58 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::updateLines(float maxWidth)
+    {
+        m_linesOutdated = false;
+        m_linesMaxWidth = maxWidth;
+
+        // Fit the text in the available space. When there is no maximum width and the text only has a single line then
+        // the word wrapping can't change anything, which saves measuring every character.
+        sf::String wrappedString;
+        const bool singleLine = (maxWidth == 0) && (m_string.find('\n') == sf::String::InvalidPos);
+        if (!singleLine)
+            wrappedString = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
+
+        const sf::String& string = singleLine ? m_string : wrappedString;
+
+        // Split the string in multiple lines
+        std::size_t lineCount = 0;
+        std::size_t searchPosStart = 0;
+        std::size_t newLinePos = 0;
+        while (newLinePos != sf::String::InvalidPos)
+        {
+            newLinePos = string.find('\n', searchPosStart);
+
+            if (lineCount == m_lines.size())
+            {
+                m_lines.emplace_back();
+                m_lines.back().setColor(m_textColorCached);
+                m_lines.back().setOpacity(m_opacityCached);
+            }
+
+            // Reused lines only need the properties that changed since they were last used
+            Text& line = m_lines[lineCount++];
+            if (line.getCharacterSize() != m_textSize)
+                line.setCharacterSize(m_textSize);
+            if (line.getFont() != m_fontCached)
+                line.setFont(m_fontCached);
+            line.setStyle(m_textStyleCached);
+
+            if (singleLine)
+                line.setString(string);
+            else if (newLinePos != sf::String::InvalidPos)
+                line.setString(string.substring(searchPosStart, newLinePos - searchPosStart));
+            else
+                line.setString(string.substring(searchPosStart));
+
+            searchPosStart = newLinePos + 1;
+        }
+
+        m_lines.erase(m_lines.begin() + lineCount, m_lines.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(std::round(getPosition().x), std::round(getPosition().y));
@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/MemoryUsage.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,7 +52,7 @@ namespace tgui
 
     ListBox::Ptr ListBox::create()
     {
-        return std::make_shared<ListBox>();
+        return makePooled<ListBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +126,8 @@ namespace tgui
 
     bool ListBox::addItem(const sf::String& itemName, const sf::String& id)
     {
+        invalidateCachedBitmap();
+
         // Check if the item limit is reached (if there is one)
         if ((m_maxItems == 0) || (m_items.size() < m_maxItems))
         {
@@ -241,6 +244,8 @@ namespace tgui
 
     bool ListBox::removeItemByIndex(std::size_t index)
     {
+        invalidateCachedBitmap();
+
         if (index >= m_items.size())
             return false;
 
@@ -270,6 +275,8 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        invalidateCachedBitmap();
+
         // Unselect any selected item
         updateSelectedItem(-1);
         updateHoveringItem(-1);
@@ -345,6 +352,8 @@ namespace tgui
 
     bool ListBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidateCachedBitmap();
+
         if (index >= m_items.size())
             return false;
 
@@ -381,6 +390,8 @@ namespace tgui
 
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
+        invalidateCachedBitmap();
+
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
@@ -406,6 +417,8 @@ namespace tgui
 
     void ListBox::setTextSize(unsigned int textSize)
     {
+        invalidateCachedBitmap();
+
         m_requestedTextSize = textSize;
 
         if (textSize)
@@ -430,6 +443,8 @@ namespace tgui
 
     void ListBox::setMaximumItems(std::size_t maximumItems)
     {
+        invalidateCachedBitmap();
+
         // Set the new limit
         m_maxItems = maximumItems;
 
@@ -552,6 +567,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                setUpdateNeeded(true);
             }
         }
 
@@ -572,11 +588,13 @@ namespace tgui
         // Check if the mouse event should go to the scrollbar
         if ((m_scroll->isMouseDown() && m_scroll->isMouseDownOnThumb()) || m_scroll->mouseOnWidget(pos))
         {
-            m_scroll->mouseMoved(pos);
+            if (m_scroll->mouseMovedOnScrollbar(pos))
+                invalidateCachedBitmap();
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
-            m_scroll->mouseNoLongerOnWidget();
+            if (m_scroll->mouseNoLongerOnScrollbar())
+                invalidateCachedBitmap();
 
             // Find out on which item the mouse is hovering
             if (FloatRect{m_bordersCached.getLeft() + m_paddingCached.getLeft(),
@@ -658,6 +676,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::reportMemoryUsage(MemoryUsage& usage) const
+    {
+        Widget::reportMemoryUsage(usage);
+
+        for (const auto& item : m_items)
+            usage.addText(item);
+        for (const auto& id : m_itemIds)
+            usage.addString(id);
+
+        usage.addWidget(*m_scroll);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::rendererChanged(const std::string& property)
     {
         if (property == "borders")
@@ -922,6 +954,7 @@ namespace tgui
             m_hoveringItem = item;
 
             updateSelectedAndHoveringItemColorsAndStyle();
+            invalidateCachedBitmap();
         }
     }
 
@@ -948,6 +981,7 @@ namespace tgui
                 onItemSelect.emit(this, "", "");
 
             updateSelectedAndHoveringItemColorsAndStyle();
+            invalidateCachedBitmap();
         }
     }
 
@@ -962,6 +996,10 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+
+        // The time only has to be tracked while waiting for a second click
+        if (!m_possibleDoubleClick)
+            setUpdateNeeded(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
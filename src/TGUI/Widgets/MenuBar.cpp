@@ -25,6 +25,7 @@
 
 #include <TGUI/Widgets/MenuBar.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/PopupLayer.hpp>
 #include <TGUI/Clipping.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +34,98 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    class MenuBar::MenuPopup : public Widget
+    {
+    public:
+
+        MenuPopup(const std::shared_ptr<MenuBar>& menuBar) :
+            m_menuBar{menuBar}
+        {
+            m_type = "MenuBarPopup";
+        }
+
+        bool mouseOnWidget(Vector2f pos) const override
+        {
+            const auto menuBar = m_menuBar.lock();
+            if (!menuBar || (menuBar->m_visibleMenu == -1))
+                return false;
+
+            return menuBar->getOpenMenuRect().contains(pos - menuBar->getAbsolutePosition());
+        }
+
+        void leftMousePressed(Vector2f pos) override
+        {
+            const auto menuBar = m_menuBar.lock();
+            if (!menuBar || (menuBar->m_visibleMenu == -1))
+                return;
+
+            menuBar->invalidateCachedBitmap();
+            menuBar->leftMousePressed(toMenuBarPos(*menuBar, pos));
+        }
+
+        void leftMouseReleased(Vector2f pos) override
+        {
+            const auto menuBar = m_menuBar.lock();
+            if (!menuBar || (menuBar->m_visibleMenu == -1))
+                return;
+
+            menuBar->invalidateCachedBitmap();
+            menuBar->leftMouseReleased(toMenuBarPos(*menuBar, pos));
+        }
+
+        void mouseMoved(Vector2f pos) override
+        {
+            Widget::mouseMoved(pos);
+
+            const auto menuBar = m_menuBar.lock();
+            if (!menuBar || (menuBar->m_visibleMenu == -1))
+                return;
+
+            menuBar->mouseMoved(toMenuBarPos(*menuBar, pos));
+        }
+
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+        {
+            const auto menuBar = m_menuBar.lock();
+            if (!menuBar || (menuBar->m_visibleMenu == -1))
+                return;
+
+            states.transform.translate(menuBar->getAbsolutePosition());
+            menuBar->drawOpenMenu(target, states);
+        }
+
+    protected:
+
+        void mouseLeftWidget() override
+        {
+            Widget::mouseLeftWidget();
+
+            if (const auto menuBar = m_menuBar.lock())
+            {
+                menuBar->invalidateCachedBitmap();
+                menuBar->mouseNoLongerOnWidget();
+            }
+        }
+
+        Widget::Ptr clone() const override
+        {
+            return nullptr;
+        }
+
+    private:
+
+        // The position of the popup is relative to the gui, while the menu bar expects positions relative to its parent
+        static Vector2f toMenuBarPos(const MenuBar& menuBar, Vector2f pos)
+        {
+            return pos - menuBar.getAbsolutePosition() + menuBar.getPosition();
+        }
+
+        std::weak_ptr<MenuBar> m_menuBar;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     MenuBar::MenuBar()
     {
         m_type = "MenuBar";
@@ -50,7 +143,7 @@ namespace tgui
 
     MenuBar::Ptr MenuBar::create()
     {
-        return std::make_shared<MenuBar>();
+        return makePooled<MenuBar>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +197,8 @@ namespace tgui
 
     void MenuBar::addMenu(const sf::String& text)
     {
+        invalidateCachedBitmap();
+
         Menu newMenu;
         newMenu.text.setFont(m_fontCached);
         newMenu.text.setColor(m_textColorCached);
@@ -117,6 +212,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& menu, const sf::String& text)
     {
+        invalidateCachedBitmap();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
@@ -153,17 +250,21 @@ namespace tgui
 
     bool MenuBar::removeMenu(const sf::String& menu)
     {
+        invalidateCachedBitmap();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
             // If this is the menu then remove it
             if (m_menus[i].text.getString() == menu)
             {
-                m_menus.erase(m_menus.begin() + i);
-
-                // The menu was removed, so it can't remain open
+                // The menu is removed, so it can't remain open
                 if (m_visibleMenu == static_cast<int>(i))
-                    m_visibleMenu = -1;
+                    closeMenu();
+                else if (m_visibleMenu > static_cast<int>(i))
+                    --m_visibleMenu;
+
+                m_menus.erase(m_menus.begin() + i);
 
                 return true;
             }
@@ -177,6 +278,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const sf::String& menu, const sf::String& menuItem)
     {
+        invalidateCachedBitmap();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
@@ -208,6 +311,9 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidateCachedBitmap();
+
+        closeMenu();
         m_menus.clear();
     }
 
@@ -215,6 +321,8 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        invalidateCachedBitmap();
+
         m_textSize = size;
 
         for (unsigned int i = 0; i < m_menus.size(); ++i)
@@ -237,6 +345,8 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
+        invalidateCachedBitmap();
+
         m_minimumSubMenuWidth = minimumWidth;
     }
 
@@ -251,6 +361,8 @@ namespace tgui
 
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
+        invalidateCachedBitmap();
+
         m_invertedMenuDirection = invertDirection;
     }
 
@@ -295,6 +407,15 @@ namespace tgui
 
             m_menus[m_visibleMenu].text.setColor(m_textColorCached);
             m_visibleMenu = -1;
+            invalidateCachedBitmap();
+
+            // Remove the popup that was showing the menu
+            if (GuiContainer* guiContainer = findGuiContainer())
+            {
+                const auto& popupLayer = guiContainer->getPopupLayer();
+                if (const Widget::Ptr popup = popupLayer->getPopupOfOwner(this))
+                    popupLayer->closePopup(popup);
+            }
         }
     }
 
@@ -307,34 +428,9 @@ namespace tgui
             return true;
         else
         {
-            // Check if there is a menu open
-            if (m_visibleMenu != -1)
-            {
-                // Search the left position of the open menu
-                float left = 0;
-                for (int i = 0; i < m_visibleMenu; ++i)
-                    left += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
-
-                // Find out what the width of the menu should be
-                float width = m_minimumSubMenuWidth;
-                for (unsigned int j = 0; j < m_menus[m_visibleMenu].menuItems.size(); ++j)
-                {
-                    if (width < m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * m_distanceToSideCached))
-                        width = m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * m_distanceToSideCached);
-                }
-
-                // Check if the mouse is on top of the open menu
-                if (m_invertedMenuDirection)
-                {
-                    if (FloatRect{left, -(getSize().y * m_menus[m_visibleMenu].menuItems.size()), width, getSize().y * m_menus[m_visibleMenu].menuItems.size()}.contains(pos))
-                        return true;
-                }
-                else
-                {
-                    if (FloatRect{getPosition().x + left, getPosition().y + getSize().y, width, getSize().y * m_menus[m_visibleMenu].menuItems.size()}.contains(pos))
-                        return true;
-                }
-            }
+            // Check if the mouse is on top of the open menu
+            if ((m_visibleMenu != -1) && getOpenMenuRect().contains(pos - getPosition()))
+                return true;
         }
 
         return false;
@@ -356,27 +452,11 @@ namespace tgui
                 {
                     // Close the menu when it was already open
                     if (m_visibleMenu == static_cast<int>(i))
-                    {
-                        if (m_menus[m_visibleMenu].selectedMenuItem != -1)
-                        {
-                            m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
-                            m_menus[m_visibleMenu].selectedMenuItem = -1;
-                        }
-
-                        m_menus[m_visibleMenu].text.setColor(m_textColorCached);
-                        m_visibleMenu = -1;
-                    }
+                        closeMenu();
 
                     // If this menu can be opened then do so
                     else if (!m_menus[i].menuItems.empty())
-                    {
-                        if (m_selectedTextColorCached.isSet())
-                            m_menus[i].text.setColor(m_selectedTextColorCached);
-                        else
-                            m_menus[i].text.setColor(m_textColorCached);
-
-                        m_visibleMenu = static_cast<int>(i);
-                    }
+                        openMenu(i);
 
                     break;
                 }
@@ -445,6 +525,7 @@ namespace tgui
                             {
                                 m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
                                 m_menus[m_visibleMenu].selectedMenuItem = -1;
+                                invalidateCachedBitmap();
                             }
                         }
                         else // The menu isn't open yet
@@ -454,14 +535,7 @@ namespace tgui
 
                             // If this menu can be opened then do so
                             if (!m_menus[i].menuItems.empty())
-                            {
-                                if (m_selectedTextColorCached.isSet())
-                                    m_menus[i].text.setColor(m_selectedTextColorCached);
-                                else
-                                    m_menus[i].text.setColor(m_textColorCached);
-
-                                m_visibleMenu = static_cast<int>(i);
-                            }
+                                openMenu(i);
                         }
                         break;
                     }
@@ -490,6 +564,8 @@ namespace tgui
                     m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_selectedTextColorCached);
                 else
                     m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
+
+                invalidateCachedBitmap();
             }
         }
     }
@@ -506,6 +582,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void MenuBar::setParent(Container* parent)
+    {
+        closeMenu();
+        Widget::setParent(parent);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::mouseLeftWidget()
     {
         // Menu items which are selected on mouse hover should not remain selected now that the mouse has left
@@ -520,6 +604,59 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void MenuBar::openMenu(std::size_t menuIndex)
+    {
+        if (m_selectedTextColorCached.isSet())
+            m_menus[menuIndex].text.setColor(m_selectedTextColorCached);
+        else
+            m_menus[menuIndex].text.setColor(m_textColorCached);
+
+        m_visibleMenu = static_cast<int>(menuIndex);
+        invalidateCachedBitmap();
+
+        // Inside a gui the menu is shown in a popup, so that it lies on top of the widgets that were added after the menu bar
+        GuiContainer* guiContainer = findGuiContainer();
+        if (guiContainer && !guiContainer->getPopupLayer()->getPopupOfOwner(this))
+        {
+            guiContainer->getPopupLayer()->openPopup(std::make_shared<MenuPopup>(std::static_pointer_cast<MenuBar>(shared_from_this())),
+                                                     shared_from_this());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MenuBar::isMenuShownInPopup() const
+    {
+        GuiContainer* guiContainer = findGuiContainer();
+        return guiContainer && guiContainer->getPopupLayer()->getPopupOfOwner(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect MenuBar::getOpenMenuRect() const
+    {
+        // Search the left position of the open menu
+        float left = 0;
+        for (int i = 0; i < m_visibleMenu; ++i)
+            left += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+
+        // Find out what the width of the menu should be
+        float width = m_minimumSubMenuWidth;
+        for (unsigned int j = 0; j < m_menus[m_visibleMenu].menuItems.size(); ++j)
+        {
+            if (width < m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * m_distanceToSideCached))
+                width = m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * m_distanceToSideCached);
+        }
+
+        const float height = getSize().y * m_menus[m_visibleMenu].menuItems.size();
+        if (m_invertedMenuDirection)
+            return {left, -height, width, height};
+        else
+            return {left, getSize().y, width, height};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& MenuBar::getSignal(std::string signalName)
     {
         if (signalName == toLower(onMenuItemClick.getName()))
@@ -695,14 +832,9 @@ namespace tgui
     {
         states.transform.translate(getPosition());
 
+        const sf::RenderStates menuBarStates = states;
         sf::RenderStates textStates = states;
 
-        float nextItemDistance;
-        if (m_invertedMenuDirection)
-            nextItemDistance = -getSize().y;
-        else
-            nextItemDistance = getSize().y;
-
         // Draw the background
         if (m_spriteBackground.isSet())
             m_spriteBackground.draw(target, states);
@@ -713,74 +845,40 @@ namespace tgui
         Sprite backgroundSprite = m_spriteItemBackground;
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
+            const Vector2f menuSize = {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y};
+
             // Is the menu open?
             if (m_visibleMenu == static_cast<int>(i))
             {
-                const sf::RenderStates oldStates = states;
-
-                // Find out what the width of the menu should be
-                float menuWidth = m_minimumSubMenuWidth;
-                for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    menuWidth = std::max(menuWidth, m_menus[i].menuItems[j].getSize().x + (2 * m_distanceToSideCached));
-
                 Sprite selectedBackgroundSprite = m_spriteSelectedItemBackground;
                 if (selectedBackgroundSprite.isSet() && backgroundSprite.isSet())
                 {
-                    selectedBackgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
+                    selectedBackgroundSprite.setSize(menuSize);
                     selectedBackgroundSprite.draw(target, states);
-
-                    backgroundSprite.setSize({menuWidth, getSize().y});
-                    selectedBackgroundSprite.setSize({menuWidth, getSize().y});
-                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    {
-                        states.transform.translate({0, nextItemDistance});
-                        if (m_menus[i].selectedMenuItem == static_cast<int>(j))
-                            selectedBackgroundSprite.draw(target, states);
-                        else
-                            backgroundSprite.draw(target, states);
-                    }
                 }
                 else if (backgroundSprite.isSet())
                 {
-                    backgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
+                    backgroundSprite.setSize(menuSize);
                     backgroundSprite.draw(target, states);
-
-                    backgroundSprite.setSize({menuWidth, getSize().y});
-                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    {
-                        states.transform.translate({0, nextItemDistance});
-                        backgroundSprite.draw(target, states);
-                    }
                 }
                 else // No textures where loaded
                 {
                     if (m_selectedBackgroundColorCached.isSet())
-                        drawRectangleShape(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y}, m_selectedBackgroundColorCached);
+                        drawRectangleShape(target, states, menuSize, m_selectedBackgroundColorCached);
                     else
-                        drawRectangleShape(target, states, {m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y}, m_backgroundColorCached);
-
-                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    {
-                        states.transform.translate({0, nextItemDistance});
-                        if ((m_menus[i].selectedMenuItem == static_cast<int>(j)) && m_selectedBackgroundColorCached.isSet())
-                            drawRectangleShape(target, states, {menuWidth, getSize().y}, m_selectedBackgroundColorCached);
-                        else
-                            drawRectangleShape(target, states, {menuWidth, getSize().y}, m_backgroundColorCached);
-                    }
+                        drawRectangleShape(target, states, menuSize, m_backgroundColorCached);
                 }
-
-                states = oldStates;
             }
             else // This menu is not open
             {
                 if (backgroundSprite.isSet())
                 {
-                    backgroundSprite.setSize({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), getSize().y});
+                    backgroundSprite.setSize(menuSize);
                     backgroundSprite.draw(target, states);
                 }
             }
 
-            states.transform.translate({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), 0});
+            states.transform.translate({menuSize.x, 0});
         }
 
         // Draw the texts of the menus
@@ -790,24 +888,84 @@ namespace tgui
             for (unsigned int i = 0; i < m_menus.size(); ++i)
             {
                 m_menus[i].text.draw(target, textStates);
+                textStates.transform.translate({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), 0});
+            }
+        }
 
-                // Draw the menu items when the menu is open
-                if (m_visibleMenu == static_cast<int>(i))
-                {
-                    const sf::RenderStates oldStates = textStates;
+        // Draw the menu items when a menu is open, unless they are drawn on top of the other widgets by the popup layer
+        if ((m_visibleMenu != -1) && !isMenuShownInPopup())
+            drawOpenMenu(target, menuBarStates);
+    }
 
-                    for (unsigned int j = 0; j < m_menus[i].menuItems.size(); ++j)
-                    {
-                        textStates.transform.translate({0, nextItemDistance});
-                        m_menus[i].menuItems[j].draw(target, textStates);
-                    }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    textStates = oldStates;
-                }
+    void MenuBar::drawOpenMenu(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        const Menu& menu = m_menus[m_visibleMenu];
 
-                textStates.transform.translate({m_menus[i].text.getSize().x + (2 * m_distanceToSideCached), 0});
+        float nextItemDistance;
+        if (m_invertedMenuDirection)
+            nextItemDistance = -getSize().y;
+        else
+            nextItemDistance = getSize().y;
+
+        // Search the left position of the open menu
+        float left = 0;
+        for (int i = 0; i < m_visibleMenu; ++i)
+            left += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+
+        states.transform.translate({left, 0});
+        sf::RenderStates textStates = states;
+
+        // Find out what the width of the menu should be
+        float menuWidth = m_minimumSubMenuWidth;
+        for (unsigned int j = 0; j < menu.menuItems.size(); ++j)
+            menuWidth = std::max(menuWidth, menu.menuItems[j].getSize().x + (2 * m_distanceToSideCached));
+
+        // Draw the backgrounds of the menu items
+        Sprite backgroundSprite = m_spriteItemBackground;
+        Sprite selectedBackgroundSprite = m_spriteSelectedItemBackground;
+        if (selectedBackgroundSprite.isSet() && backgroundSprite.isSet())
+        {
+            backgroundSprite.setSize({menuWidth, getSize().y});
+            selectedBackgroundSprite.setSize({menuWidth, getSize().y});
+            for (unsigned int j = 0; j < menu.menuItems.size(); ++j)
+            {
+                states.transform.translate({0, nextItemDistance});
+                if (menu.selectedMenuItem == static_cast<int>(j))
+                    selectedBackgroundSprite.draw(target, states);
+                else
+                    backgroundSprite.draw(target, states);
+            }
+        }
+        else if (backgroundSprite.isSet())
+        {
+            backgroundSprite.setSize({menuWidth, getSize().y});
+            for (unsigned int j = 0; j < menu.menuItems.size(); ++j)
+            {
+                states.transform.translate({0, nextItemDistance});
+                backgroundSprite.draw(target, states);
             }
         }
+        else // No textures where loaded
+        {
+            for (unsigned int j = 0; j < menu.menuItems.size(); ++j)
+            {
+                states.transform.translate({0, nextItemDistance});
+                if ((menu.selectedMenuItem == static_cast<int>(j)) && m_selectedBackgroundColorCached.isSet())
+                    drawRectangleShape(target, states, {menuWidth, getSize().y}, m_selectedBackgroundColorCached);
+                else
+                    drawRectangleShape(target, states, {menuWidth, getSize().y}, m_backgroundColorCached);
+            }
+        }
+
+        // Draw the texts of the menu items
+        textStates.transform.translate({m_distanceToSideCached, (getSize().y - m_menus[0].text.getSize().y) / 2.f});
+        for (unsigned int j = 0; j < menu.menuItems.size(); ++j)
+        {
+            textStates.transform.translate({0, nextItemDistance});
+            menu.menuItems[j].draw(target, textStates);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
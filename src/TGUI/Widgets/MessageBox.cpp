@@ -127,7 +127,7 @@ namespace tgui
 
     MessageBox::Ptr MessageBox::create(sf::String title, sf::String text, std::vector<sf::String> buttons)
     {
-        auto messageBox = std::make_shared<MessageBox>();
+        auto messageBox = makePooled<MessageBox>();
         messageBox->setTitle(title);
         messageBox->setText(text);
         for (auto& buttonText : buttons)
@@ -47,7 +47,7 @@ namespace tgui
 
     Panel::Ptr Panel::create(Layout2d size)
     {
-        return std::make_shared<Panel>(size);
+        return makePooled<Panel>(size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
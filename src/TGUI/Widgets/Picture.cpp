@@ -52,7 +52,7 @@ namespace tgui
 
     Picture::Ptr Picture::create(const Texture& texture, bool fullyClickable)
     {
-        return std::make_shared<Picture>(texture, fullyClickable);
+        return makePooled<Picture>(texture, fullyClickable);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +159,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                setUpdateNeeded(true);
             }
         }
     }
@@ -181,7 +182,10 @@ namespace tgui
         {
             const auto& texture = getSharedRenderer()->getTexture();
 
-            if (!m_sprite.isSet() && (getSize() == Vector2f{0,0}))
+            // The size of an image that is loaded in the background is only known once this function is called again for the
+            // same texture after it finished loading
+            if ((!m_sprite.isSet() || (m_sprite.getTexture().getData() == texture.getData()))
+             && !texture.isLoading() && (getSize() == Vector2f{0,0}))
                 setSize(texture.getImageSize());
 
             m_sprite.setTexture(texture);
@@ -228,6 +232,10 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_possibleDoubleClick = false;
         }
+
+        // The time only has to be tracked while waiting for a second click
+        if (!m_possibleDoubleClick)
+            setUpdateNeeded(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -51,7 +51,7 @@ namespace tgui
 
     ProgressBar::Ptr ProgressBar::create()
     {
-        return std::make_shared<ProgressBar>();
+        return makePooled<ProgressBar>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -208,6 +208,8 @@ namespace tgui
 
     void ProgressBar::setText(const sf::String& text)
     {
+        invalidateCachedBitmap();
+
         // Set the new text
         m_textBack.setString(text);
         m_textFront.setString(text);
@@ -437,6 +439,8 @@ namespace tgui
 
     void ProgressBar::recalculateFillSize()
     {
+        invalidateCachedBitmap();
+
         Vector2f size;
         if (m_spriteFill.isSet())
         {
@@ -480,7 +484,8 @@ namespace tgui
 
     Vector2f ProgressBar::getFrontImageSize() const
     {
-        if (m_spriteBackground.isSet())
+        // The images can't be used to calculate the size before they finished loading
+        if (m_spriteBackground.isSet() && !m_spriteBackground.getTexture().isLoading() && !m_spriteFill.getTexture().isLoading())
         {
             switch (m_spriteBackground.getScalingType())
             {
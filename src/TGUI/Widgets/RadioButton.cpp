@@ -24,8 +24,8 @@
 
 
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 #include <TGUI/Container.hpp>
-#include <SFML/Graphics/CircleShape.hpp>
 
 namespace tgui
 {
@@ -48,7 +48,7 @@ namespace tgui
 
     RadioButton::Ptr RadioButton::create()
     {
-        return std::make_shared<RadioButton>();
+        return makePooled<RadioButton>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +159,7 @@ namespace tgui
     {
         // Set the new text
         m_text.setString(text);
+        invalidateCachedBitmap();
 
         // Set the text size
         if (m_textSize == 0)
@@ -609,6 +610,9 @@ namespace tgui
 
     void RadioButton::updateTextColor()
     {
+        // The text color changes together with the checked and hover state, which also change the looks of the check box
+        invalidateCachedBitmap();
+
         if (m_checked)
         {
             if (!m_enabled && getSharedRenderer()->getTextColorCheckedDisabled().isSet())
@@ -655,11 +659,11 @@ namespace tgui
         const float innerRadius = std::min(getInnerSize().x, getInnerSize().y) / 2;
         if (m_bordersCached != Borders{0})
         {
-            sf::CircleShape circle{innerRadius + m_bordersCached.getLeft()};
-            circle.setOutlineThickness(-m_bordersCached.getLeft());
-            circle.setFillColor(Color::Transparent);
-            circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            m_bordersShape.setRadius(innerRadius + m_bordersCached.getLeft());
+            m_bordersShape.setOutlineThickness(-m_bordersCached.getLeft());
+            m_bordersShape.setFillColor(Color::Transparent);
+            m_bordersShape.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
+            m_bordersShape.draw(target, states);
         }
 
         // Draw the box
@@ -691,17 +695,19 @@ namespace tgui
         }
         else // There are no images
         {
-            sf::CircleShape circle{innerRadius};
-            circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            m_backgroundShape.setRadius(innerRadius);
+            m_backgroundShape.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
+            m_backgroundShape.draw(target, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
             {
-                sf::CircleShape checkShape{innerRadius * 0.4f};
-                checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
-                checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                m_checkShape.setRadius(innerRadius * 0.4f);
+                m_checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
+
+                sf::RenderStates checkStates = states;
+                checkStates.transform.translate({innerRadius - m_checkShape.getRadius(), innerRadius - m_checkShape.getRadius()});
+                m_checkShape.draw(target, checkStates);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
@@ -40,7 +40,7 @@ namespace tgui
 
     RadioButtonGroup::Ptr RadioButtonGroup::create()
     {
-        return std::make_shared<RadioButtonGroup>();
+        return makePooled<RadioButtonGroup>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
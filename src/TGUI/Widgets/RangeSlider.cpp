@@ -48,7 +48,7 @@ namespace tgui
 
     RangeSlider::Ptr RangeSlider::create(float minimum, float maximum)
     {
-        auto slider = std::make_shared<RangeSlider>();
+        auto slider = makePooled<RangeSlider>();
 
         slider->setMinimum(minimum);
         slider->setMaximum(maximum);
@@ -107,7 +107,8 @@ namespace tgui
         else
             m_verticalScroll = false;
 
-        if (m_spriteTrack.isSet() && m_spriteThumb.isSet())
+        // The sizes of the images are only known once they finished loading
+        if (m_spriteTrack.isSet() && m_spriteThumb.isSet() && !m_spriteTrack.getTexture().isLoading() && !m_spriteThumb.getTexture().isLoading())
         {
             float scaleFactor;
             if (m_verticalImage == m_verticalScroll)
@@ -153,7 +154,7 @@ namespace tgui
                 m_spriteThumbHover.setRotation(0);
             }
         }
-        else // There are no textures
+        else // There are no textures (or they are still being loaded)
         {
             if (m_verticalScroll)
             {
@@ -614,6 +615,8 @@ namespace tgui
 
     void RangeSlider::updateThumbPositions()
     {
+        invalidateCachedBitmap();
+
         const Vector2f innerSize = getInnerSize();
 
         if (m_verticalScroll)
@@ -146,7 +146,7 @@ namespace tgui
 
     ScrollablePanel::Ptr ScrollablePanel::create(Layout2d size, Vector2f contentSize)
     {
-        return std::make_shared<ScrollablePanel>(size, contentSize);
+        return makePooled<ScrollablePanel>(size, contentSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -420,11 +420,13 @@ namespace tgui
         // Check if the mouse event should go to the scrollbar
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->mouseOnWidget(pos - getPosition()))
         {
-            m_verticalScrollbar->mouseMoved(pos - getPosition());
+            if (m_verticalScrollbar->mouseMovedOnScrollbar(pos - getPosition()))
+                invalidateCachedBitmap();
         }
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->mouseOnWidget(pos - getPosition()))
         {
-            m_horizontalScrollbar->mouseMoved(pos - getPosition());
+            if (m_horizontalScrollbar->mouseMovedOnScrollbar(pos - getPosition()))
+                invalidateCachedBitmap();
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
@@ -434,8 +436,10 @@ namespace tgui
                                    pos.y + static_cast<float>(m_verticalScrollbar->getValue())});
             }
 
-            m_verticalScrollbar->mouseNoLongerOnWidget();
-            m_horizontalScrollbar->mouseNoLongerOnWidget();
+            const bool verticalScrollbarChanged = m_verticalScrollbar->mouseNoLongerOnScrollbar();
+            const bool horizontalScrollbarChanged = m_horizontalScrollbar->mouseNoLongerOnScrollbar();
+            if (verticalScrollbarChanged || horizontalScrollbarChanged)
+                invalidateCachedBitmap();
         }
     }
 
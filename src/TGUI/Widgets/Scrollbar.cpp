@@ -24,7 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -49,7 +49,7 @@ namespace tgui
 
     Scrollbar::Ptr Scrollbar::create()
     {
-        return std::make_shared<Scrollbar>();
+        return makePooled<Scrollbar>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -197,6 +197,8 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        invalidateCachedBitmap();
+
         m_autoHide = autoHide;
     }
 
@@ -390,6 +392,7 @@ namespace tgui
     void Scrollbar::mouseMoved(Vector2f pos)
     {
         pos -= getPosition();
+        const Part oldHoverPart = m_mouseHoverOverPart;
 
         if (!m_mouseHover)
             mouseEnteredWidget();
@@ -547,6 +550,10 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(pos))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        // The thumb follows the mouse while it is being dragged
+        if (m_mouseDown || (m_mouseHoverOverPart != oldHoverPart))
+            invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,13 +585,17 @@ namespace tgui
 
     void Scrollbar::updateSize()
     {
+        invalidateCachedBitmap();
+
         if (getSize().x <= getSize().y)
             m_verticalScroll = true;
         else
             m_verticalScroll = false;
 
+        // The sizes of the images are only known once they finished loading
         bool textured = false;
-        if (m_spriteTrack.isSet() && m_spriteThumb.isSet() && m_spriteArrowUp.isSet() && m_spriteArrowDown.isSet())
+        if (m_spriteTrack.isSet() && m_spriteThumb.isSet() && m_spriteArrowUp.isSet() && m_spriteArrowDown.isSet()
+         && !m_spriteArrowUp.getTexture().isLoading() && !m_spriteArrowDown.getTexture().isLoading())
             textured = true;
 
         if (m_verticalScroll)
@@ -895,26 +906,24 @@ namespace tgui
             else
                 drawRectangleShape(target, states, {m_arrowUp.width, m_arrowUp.height}, m_arrowBackgroundColorCached);
 
-            sf::ConvexShape arrow{3};
+            Color arrowColor;
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::ArrowUp) && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached);
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorCached, m_opacityCached);
 
             if (m_verticalScroll)
             {
-                arrow.setPoint(0, {m_arrowUp.width / 5, m_arrowUp.height * 4/5});
-                arrow.setPoint(1, {m_arrowUp.width / 2, m_arrowUp.height / 5});
-                arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
+                drawTriangle(target, states, {m_arrowUp.width / 5, m_arrowUp.height * 4/5},
+                                             {m_arrowUp.width / 2, m_arrowUp.height / 5},
+                                             {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5}, arrowColor);
             }
             else
             {
-                arrow.setPoint(0, {m_arrowUp.width * 4/5, m_arrowUp.height / 5});
-                arrow.setPoint(1, {m_arrowUp.width / 5, m_arrowUp.height / 2});
-                arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
+                drawTriangle(target, states, {m_arrowUp.width * 4/5, m_arrowUp.height / 5},
+                                             {m_arrowUp.width / 5, m_arrowUp.height / 2},
+                                             {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5}, arrowColor);
             }
-
-            target.draw(arrow, states);
         }
 
         // Draw the track
@@ -969,26 +978,24 @@ namespace tgui
             else
                 drawRectangleShape(target, states, {m_arrowDown.width, m_arrowDown.height}, m_arrowBackgroundColorCached);
 
-            sf::ConvexShape arrow{3};
+            Color arrowColor;
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::ArrowDown) && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached);
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorCached, m_opacityCached);
 
             if (m_verticalScroll)
             {
-                arrow.setPoint(0, {m_arrowDown.width / 5, m_arrowDown.height / 5});
-                arrow.setPoint(1, {m_arrowDown.width / 2, m_arrowDown.height * 4/5});
-                arrow.setPoint(2, {m_arrowDown.width * 4/5, m_arrowDown.height / 5});
+                drawTriangle(target, states, {m_arrowDown.width / 5, m_arrowDown.height / 5},
+                                             {m_arrowDown.width / 2, m_arrowDown.height * 4/5},
+                                             {m_arrowDown.width * 4/5, m_arrowDown.height / 5}, arrowColor);
             }
             else // Spin button lies horizontal
             {
-                arrow.setPoint(0, {m_arrowDown.width / 5, m_arrowDown.height / 5});
-                arrow.setPoint(1, {m_arrowDown.width * 4/5, m_arrowDown.height / 2});
-                arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
+                drawTriangle(target, states, {m_arrowDown.width / 5, m_arrowDown.height / 5},
+                                             {m_arrowDown.width * 4/5, m_arrowDown.height / 2},
+                                             {m_arrowDown.width / 5, m_arrowDown.height * 4/5}, arrowColor);
             }
-
-            target.draw(arrow, states);
         }
     }
 
@@ -1015,6 +1022,27 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollbarChildWidget::mouseMovedOnScrollbar(Vector2f pos)
+    {
+        const bool wasMouseHover = m_mouseHover;
+        const Part oldHoverPart = m_mouseHoverOverPart;
+
+        mouseMoved(pos);
+        return !wasMouseHover || m_mouseDown || (m_mouseHoverOverPart != oldHoverPart);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollbarChildWidget::mouseNoLongerOnScrollbar()
+    {
+        const bool wasMouseHover = m_mouseHover;
+
+        mouseNoLongerOnWidget();
+        return wasMouseHover;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,8 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -47,7 +46,7 @@ namespace tgui
 
     SpinButton::Ptr SpinButton::create(float minimum, float maximum)
     {
-        auto spinButton = std::make_shared<SpinButton>();
+        auto spinButton = makePooled<SpinButton>();
 
         spinButton->setMinimum(minimum);
         spinButton->setMaximum(maximum);
@@ -281,6 +280,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(Vector2f pos)
     {
+        const bool oldMouseHoverOnTopArrow = m_mouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_verticalScroll)
         {
@@ -297,6 +298,9 @@ namespace tgui
                 m_mouseHoverOnTopArrow = false;
         }
 
+        if (m_mouseHoverOnTopArrow != oldMouseHoverOnTopArrow)
+            invalidateCachedBitmap();
+
         if (!m_mouseHover)
             mouseEnteredWidget();
     }
@@ -439,38 +443,23 @@ namespace tgui
         }
         else
         {
-            sf::ConvexShape arrow{3};
-            sf::RectangleShape arrowBack;
-
-            if (m_verticalScroll)
-            {
-                arrowBack.setSize(arrowSize);
-
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y * 4/5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 2, arrowBack.getSize().y / 5});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y * 4/5});
-            }
-            else // Spin button lies horizontal
-            {
-                arrowBack.setSize({arrowSize.y, arrowSize.x});
-
-                arrow.setPoint(0, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 2});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y * 4/5});
-            }
+            const Vector2f arrowBackSize = m_verticalScroll ? arrowSize : Vector2f{arrowSize.y, arrowSize.x};
 
             if (m_mouseHover && m_mouseHoverOnTopArrow && m_backgroundColorHoverCached.isSet())
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorHoverCached, m_opacityCached));
+                drawRectangleShape(target, states, arrowBackSize, m_backgroundColorHoverCached);
             else
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+                drawRectangleShape(target, states, arrowBackSize, m_backgroundColorCached);
 
+            Color arrowColor;
             if (m_mouseHover && m_mouseHoverOnTopArrow && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached);
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorCached, m_opacityCached);
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            if (m_verticalScroll)
+                drawTriangle(target, states, {arrowBackSize.x / 5, arrowBackSize.y * 4/5}, {arrowBackSize.x / 2, arrowBackSize.y / 5}, {arrowBackSize.x * 4/5, arrowBackSize.y * 4/5}, arrowColor);
+            else // Spin button lies horizontal
+                drawTriangle(target, states, {arrowBackSize.x * 4/5, arrowBackSize.y / 5}, {arrowBackSize.x / 5, arrowBackSize.y / 2}, {arrowBackSize.x * 4/5, arrowBackSize.y * 4/5}, arrowColor);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -505,38 +494,23 @@ namespace tgui
         }
         else // There are no images
         {
-            sf::ConvexShape arrow{3};
-            sf::RectangleShape arrowBack;
-
-            if (m_verticalScroll)
-            {
-                arrowBack.setSize(arrowSize);
-
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 2, arrowBack.getSize().y * 4/5});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 5});
-            }
-            else // Spin button lies horizontal
-            {
-                arrowBack.setSize({arrowSize.y, arrowSize.x});
-
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 2});
-                arrow.setPoint(2, {arrowBack.getSize().x / 5, arrowBack.getSize().y * 4/5});
-            }
+            const Vector2f arrowBackSize = m_verticalScroll ? arrowSize : Vector2f{arrowSize.y, arrowSize.x};
 
             if (m_mouseHover && !m_mouseHoverOnTopArrow && m_backgroundColorHoverCached.isSet())
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorHoverCached, m_opacityCached));
+                drawRectangleShape(target, states, arrowBackSize, m_backgroundColorHoverCached);
             else
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+                drawRectangleShape(target, states, arrowBackSize, m_backgroundColorCached);
 
+            Color arrowColor;
             if (m_mouseHover && !m_mouseHoverOnTopArrow && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached);
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorCached, m_opacityCached);
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            if (m_verticalScroll)
+                drawTriangle(target, states, {arrowBackSize.x / 5, arrowBackSize.y / 5}, {arrowBackSize.x / 2, arrowBackSize.y * 4/5}, {arrowBackSize.x * 4/5, arrowBackSize.y / 5}, arrowColor);
+            else // Spin button lies horizontal
+                drawTriangle(target, states, {arrowBackSize.x / 5, arrowBackSize.y / 5}, {arrowBackSize.x * 4/5, arrowBackSize.y / 2}, {arrowBackSize.x / 5, arrowBackSize.y * 4/5}, arrowColor);
         }
     }
 
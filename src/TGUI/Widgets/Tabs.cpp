@@ -52,7 +52,7 @@ namespace tgui
 
     Tabs::Ptr Tabs::create()
     {
-        return std::make_shared<Tabs>();
+        return makePooled<Tabs>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,6 +235,7 @@ namespace tgui
         // Select the tab
         m_selectedTab = static_cast<int>(index);
         m_tabs[m_selectedTab].text.setColor(m_selectedTextColorCached);
+        invalidateCachedBitmap();
 
         // Send the callback
         onTabSelect.emit(this, m_tabs[index].text.getString());
@@ -249,6 +250,7 @@ namespace tgui
         {
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
             m_selectedTab = -1;
+            invalidateCachedBitmap();
         }
     }
 
@@ -284,6 +286,8 @@ namespace tgui
 
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
+
+        invalidateCachedBitmap();
         return true;
     }
 
@@ -473,6 +477,7 @@ namespace tgui
         Widget::mouseMoved(pos);
 
         pos -= getPosition();
+        const int oldHoveringTab = m_hoveringTab;
         m_hoveringTab = -1;
         float width = m_bordersCached.getLeft() / 2.f;
 
@@ -493,6 +498,9 @@ namespace tgui
                 break;
             }
         }
+
+        if (m_hoveringTab != oldHoveringTab)
+            invalidateCachedBitmap();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -508,6 +516,8 @@ namespace tgui
 
     void Tabs::recalculateTabsWidth()
     {
+        invalidateCachedBitmap();
+
         unsigned int visibleTabs = 0;
         for (unsigned int i = 0; i < m_tabs.size(); ++i)
         {
@@ -777,6 +787,8 @@ namespace tgui
 
     void Tabs::updateTextColors()
     {
+        invalidateCachedBitmap();
+
         for (auto& tab : m_tabs)
         {
             if ((!m_enabled || !tab.enabled) && m_textColorDisabledCached.isSet())
@@ -27,6 +27,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/MemoryUsage.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 
 #include <cmath>
 
@@ -34,17 +36,30 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Replaces the cached values of the lines in the range [firstLine, lastLine) with newLineCount values that still
+        // have to be calculated. The values of the other lines are kept, unless the cache didn't match the lines anyway.
+        template <typename T>
+        void replaceLineCache(std::vector<T>& cache, std::size_t oldLineCount, std::size_t firstLine, std::size_t lastLine, std::size_t newLineCount)
+        {
+            if (cache.size() != oldLineCount)
+            {
+                cache.clear();
+                return;
+            }
+
+            cache.erase(cache.begin() + firstLine, cache.begin() + lastLine);
+            cache.insert(cache.begin() + firstLine, newLineCount, T{});
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TextBox::TextBox()
     {
         m_type = "TextBox";
         m_draggableWidget = true;
-        m_textBeforeSelection.setFont(m_fontCached);
-        m_textSelection1.setFont(m_fontCached);
-        m_textSelection2.setFont(m_fontCached);
-        m_textAfterSelection1.setFont(m_fontCached);
-        m_textAfterSelection2.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<TextBoxRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -59,7 +74,7 @@ namespace tgui
 
     TextBox::Ptr TextBox::create()
     {
-        return std::make_shared<TextBox>();
+        return makePooled<TextBox>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +151,7 @@ namespace tgui
         else
             m_text = text;
 
+        m_textCached = true;
         rearrangeText(false);
     }
 
@@ -143,13 +159,24 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        // Only the last paragraph has to be word wrapped again, the rest of the text remains untouched
+        const std::size_t textLength = getTextLength();
+        if ((m_maxChars > 0) && (textLength + text.getSize() > m_maxChars))
+            replaceText(textLength, 0, text.substring(0, m_maxChars - std::min(textLength, m_maxChars)));
+        else
+            replaceText(textLength, 0, text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& TextBox::getText() const
     {
+        if (!m_textCached)
+        {
+            m_text = getLinesText(0, m_lines.size());
+            m_textCached = true;
+        }
+
         return m_text;
     }
 
@@ -161,7 +188,7 @@ namespace tgui
         if (pos.first > pos.second)
             std::swap(pos.first, pos.second);
 
-        return m_text.substring(pos.first, pos.second - pos.first);
+        return getTextPart(pos.first, pos.second - pos.first);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,13 +200,6 @@ namespace tgui
         if (m_textSize < 1)
             m_textSize = 1;
 
-        // Change the text size
-        m_textBeforeSelection.setCharacterSize(m_textSize);
-        m_textSelection1.setCharacterSize(m_textSize);
-        m_textSelection2.setCharacterSize(m_textSize);
-        m_textAfterSelection1.setCharacterSize(m_textSize);
-        m_textAfterSelection2.setCharacterSize(m_textSize);
-
         // Calculate the height of one line
         m_lineHeight = static_cast<unsigned int>(m_fontCached.getLineSpacing(m_textSize));
 
@@ -203,11 +223,11 @@ namespace tgui
         m_maxChars = maxChars;
 
         // If there is a character limit then check if it is exceeded
-        if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
+        const std::size_t textLength = getTextLength();
+        if ((m_maxChars > 0) && (textLength > m_maxChars))
         {
             // Remove all the excess characters
-            m_text.erase(m_maxChars, sf::String::InvalidPos);
-            rearrangeText(false);
+            replaceText(m_maxChars, textLength - m_maxChars, "");
         }
     }
 
@@ -246,29 +266,13 @@ namespace tgui
     void TextBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
         // The caret position has to stay inside the string
-        if (charactersBeforeCaret > m_text.getSize())
-            charactersBeforeCaret = m_text.getSize();
+        if (charactersBeforeCaret > getTextLength())
+            charactersBeforeCaret = getTextLength();
 
         // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
-        {
-            if (count + m_lines[i].getSize() < charactersBeforeCaret)
-            {
-                count += m_lines[i].getSize();
-                if ((count < m_text.getSize()) && (m_text[count] == '\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
-
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
-        }
+        m_selStart = findLinePosition(charactersBeforeCaret);
+        m_selEnd = m_selStart;
+        updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,6 +311,7 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+            setUpdateNeeded(true);
         }
         else // Unfocusing
         {
@@ -413,6 +418,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                setUpdateNeeded(true);
             }
 
             // Update the texts
@@ -455,7 +461,9 @@ namespace tgui
         // Check if the mouse event should go to the scrollbar
         if (m_verticalScroll->isShown() && ((m_verticalScroll->isMouseDown() && m_verticalScroll->isMouseDownOnThumb()) || m_verticalScroll->mouseOnWidget(pos)))
         {
-            m_verticalScroll->mouseMoved(pos);
+            if (m_verticalScroll->mouseMovedOnScrollbar(pos))
+                invalidateCachedBitmap();
+
             recalculateVisibleLines();
         }
 
@@ -467,6 +475,7 @@ namespace tgui
             {
                 m_selEnd = caretPosition;
                 updateSelectionTexts();
+                invalidateCachedBitmap();
             }
 
             // Check if the caret is located above or below the view
@@ -776,37 +785,7 @@ namespace tgui
                 {
                     const std::size_t pos = findTextSelectionPositions().second;
                     if (pos > 0)
-                    {
-                        if (m_selEnd.x > 0)
-                        {
-                            // There is a specific case that we have to watch out for. When we are removing the last character on
-                            // a line which was placed there by word wrap and a newline follows this character then the caret
-                            // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                            if ((m_lines[m_selEnd.y].getSize() == 1) && (pos > 1) && (pos < m_text.getSize()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
-                            {
-                                m_selEnd.y--;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-                            }
-                            else // Just remove the character normally
-                                --m_selEnd.x;
-                        }
-                        else // At the beginning of the line
-                        {
-                            if (m_selEnd.y > 0)
-                            {
-                                --m_selEnd.y;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-
-                                if ((m_text[pos-1] != '\n') && m_selEnd.x > 0)
-                                    --m_selEnd.x;
-                            }
-                        }
-
-                        m_selStart = m_selEnd;
-
-                        m_text.erase(pos - 1, 1);
-                        rearrangeText(true);
-                    }
+                        replaceText(pos - 1, 1, "");
                 }
                 else // When you did select some characters then delete them
                     deleteSelectedCharacters();
@@ -815,7 +794,8 @@ namespace tgui
                 m_caretVisible = true;
                 m_animationTimeElapsed = {};
 
-                onTextChange.emit(this, m_text);
+                if (onTextChange.isConnected())
+                    onTextChange.emit(this, getText());
                 break;
             }
 
@@ -827,13 +807,15 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(findTextSelectionPositions().second, 1);
-                    rearrangeText(true);
+                    const std::size_t pos = findTextSelectionPositions().second;
+                    if (pos < getTextLength())
+                        replaceText(pos, 1, "");
                 }
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
 
-                onTextChange.emit(this, m_text);
+                if (onTextChange.isConnected())
+                    onTextChange.emit(this, getText());
                 break;
             }
 
@@ -851,12 +833,8 @@ namespace tgui
 
             case sf::Keyboard::C:
             {
-                auto selectionPositions = findTextSelectionPositions();
-                if (selectionPositions.first > selectionPositions.second)
-                    std::swap(selectionPositions.first, selectionPositions.second);
-
                 if (event.control && !event.alt && !event.shift && !event.system)
-                    Clipboard::set(m_text.substring(selectionPositions.first, selectionPositions.second - selectionPositions.first));
+                    Clipboard::set(getSelectedText());
 
                 break;
             }
@@ -865,11 +843,7 @@ namespace tgui
             {
                 if (event.control && !event.alt && !event.shift && !event.system && !m_readOnly)
                 {
-                    auto selectionPositions = findTextSelectionPositions();
-                    if (selectionPositions.first > selectionPositions.second)
-                        std::swap(selectionPositions.first, selectionPositions.second);
-
-                    Clipboard::set(m_text.substring(selectionPositions.first, selectionPositions.second - selectionPositions.first));
+                    Clipboard::set(getSelectedText());
                     deleteSelectedCharacters();
                 }
 
@@ -885,16 +859,14 @@ namespace tgui
                     // Only continue pasting if you actually have to do something
                     if ((m_selStart != m_selEnd) || (clipboardContents != ""))
                     {
-                        deleteSelectedCharacters();
+                        auto selectionPositions = findTextSelectionPositions();
+                        if (selectionPositions.first > selectionPositions.second)
+                            std::swap(selectionPositions.first, selectionPositions.second);
 
-                        m_text.insert(findTextSelectionPositions().first, clipboardContents);
-                        m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
+                        replaceText(selectionPositions.first, selectionPositions.second - selectionPositions.first, clipboardContents);
 
-                        m_selStart.x += clipboardContents.getSize();
-                        m_selEnd = m_selStart;
-                        rearrangeText(true);
-
-                        onTextChange.emit(this, m_text);
+                        if (onTextChange.isConnected())
+                            onTextChange.emit(this, getText());
                     }
                 }
 
@@ -918,51 +890,36 @@ namespace tgui
             return;
 
         // Make sure we don't exceed our maximum characters limit
-        if ((m_maxChars > 0) && (m_text.getSize() + 1 > m_maxChars))
+        if ((m_maxChars > 0) && (getTextLength() + 1 > m_maxChars))
             return;
 
-        auto insert = [=]()
-        {
-            deleteSelectedCharacters();
-
-            const std::size_t caretPosition = findTextSelectionPositions().first;
-
-            m_text.insert(caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, key);
-
-            // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
-            if ((key != '\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].isEmpty() || (m_text[caretPosition-1] == '\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
-
-            rearrangeText(true);
-        };
+        auto selectionPositions = findTextSelectionPositions();
+        if (selectionPositions.first > selectionPositions.second)
+            std::swap(selectionPositions.first, selectionPositions.second);
 
         // If there is a scrollbar then inserting can't go wrong
         if (isVerticalScrollbarPresent())
         {
-            insert();
+            replaceText(selectionPositions.first, selectionPositions.second - selectionPositions.first, sf::String(key));
         }
         else // There is no scrollbar, the text may not fit
         {
             // Store the data so that it can be reverted
-            sf::String oldText = m_text;
+            const sf::String replacedText = getTextPart(selectionPositions.first, selectionPositions.second - selectionPositions.first);
             const auto oldSelStart = m_selStart;
             const auto oldSelEnd = m_selEnd;
 
             // Try to insert the character
-            insert();
+            replaceText(selectionPositions.first, selectionPositions.second - selectionPositions.first, sf::String(key));
 
             // Undo the insert if the text does not fit
             if (m_lines.size() > getInnerSize().y / m_lineHeight)
             {
-                m_text = oldText;
+                replaceText(selectionPositions.first, 1, replacedText);
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
 
-                rearrangeText(true);
+                updateSelectionTexts();
             }
         }
 
@@ -970,7 +927,8 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        if (onTextChange.isConnected())
+            onTextChange.emit(this, getText());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1018,33 +976,25 @@ namespace tgui
         if (lineNumber + 1 > m_lines.size())
             return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
 
-        // Find between which character the mouse is standing
-        float width = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-        std::uint32_t prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
+        // Find the first character of which the right side lies behind the mouse
+        const float posX = position.x - Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        const std::vector<float>& charPositions = getLineCharacterPositions(lineNumber);
+        const auto it = std::upper_bound(charPositions.begin() + 1, charPositions.end(), posX);
+        if (it != charPositions.end())
         {
+            const std::size_t i = static_cast<std::size_t>(it - charPositions.begin()) - 1;
+
             float charWidth;
             const std::uint32_t curChar = m_lines[lineNumber][i];
-            //if (curChar == '\n')
-            //    return sf::Vector2f<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
-            //else
             if (curChar == '\t')
                 charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
             else
                 charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
 
-            const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize());
-            if (width + charWidth + kerning <= position.x)
-                width += charWidth + kerning;
+            if (posX < charPositions[i + 1] - (charWidth / 2.0f))
+                return {i, lineNumber};
             else
-            {
-                if (position.x < width + kerning + (charWidth / 2.0f))
-                    return {i, lineNumber};
-                else
-                    return {i + 1, lineNumber};
-            }
-
-            prevChar = curChar;
+                return {i + 1, lineNumber};
         }
 
         // You clicked behind the last character
@@ -1053,76 +1003,301 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::pair<std::size_t, std::size_t> TextBox::findTextSelectionPositions() const
+    const std::vector<float>& TextBox::getLineCharacterPositions(std::size_t lineNumber) const
+    {
+        if (m_lineCharPositions.size() != m_lines.size())
+            m_lineCharPositions.resize(m_lines.size());
+
+        std::vector<float>& charPositions = m_lineCharPositions[lineNumber];
+        if (!charPositions.empty())
+            return charPositions;
+
+        const sf::String& line = m_lines[lineNumber];
+        charPositions.resize(line.getSize() + 1);
+        charPositions[0] = 0;
+
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < line.getSize(); ++i)
+        {
+            float charWidth;
+            const std::uint32_t curChar = line[i];
+            if (curChar == '\t')
+                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+            else
+                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+
+            charPositions[i + 1] = charPositions[i] + m_fontCached.getKerning(prevChar, curChar, getTextSize()) + charWidth;
+            prevChar = curChar;
+        }
+
+        return charPositions;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<sf::Vertex>& TextBox::getLineVertices(std::size_t lineNumber) const
     {
-        // This function is used to count the amount of characters spread over several lines
-        auto findIndex = [this](std::size_t line)
+        if (m_lineVertices.size() != m_lines.size())
+            m_lineVertices.resize(m_lines.size());
+
+        std::vector<sf::Vertex>& vertices = m_lineVertices[lineNumber];
+        const sf::String& line = m_lines[lineNumber];
+        if (!vertices.empty() || line.isEmpty())
+            return vertices;
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        const float padding = 1; // Glyphs are surrounded by a transparent border in the font texture since SFML 2.5
+    #else
+        const float padding = 0;
+    #endif
+
+        // The characters are placed the same way as sf::Text does it. The vertices are relative to the top of the line, so that
+        // they remain valid when lines are inserted or removed above this line.
+        const std::vector<float>& charPositions = getLineCharacterPositions(lineNumber);
+        const float baseline = static_cast<float>(m_textSize);
+        const sf::Color color = Color::calcColorOpacity(m_textColorCached, m_opacityCached);
+
+        vertices.resize(line.getSize() * 6);
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < line.getSize(); ++i)
         {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
+            const std::uint32_t curChar = line[i];
+            const float x = charPositions[i] + m_fontCached.getKerning(prevChar, curChar, m_textSize);
+            prevChar = curChar;
+
+            sf::Vertex* quad = &vertices[i * 6];
+            if ((curChar == ' ') || (curChar == '\t'))
             {
-                counter += m_lines[i].getSize();
-                if ((counter < m_text.getSize()) && (m_text[counter] == '\n'))
-                    counter += 1;
+                for (unsigned int j = 0; j < 6; ++j)
+                    quad[j] = sf::Vertex{{x, baseline}, color};
+
+                continue;
             }
 
-            return counter;
-        };
+            const sf::Glyph& glyph = m_fontCached.getGlyph(curChar, m_textSize, false);
+            const float left = glyph.bounds.left - padding;
+            const float top = glyph.bounds.top - padding;
+            const float right = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+            quad[0] = sf::Vertex{{x + left, baseline + top}, color, {u1, v1}};
+            quad[1] = sf::Vertex{{x + right, baseline + top}, color, {u2, v1}};
+            quad[2] = sf::Vertex{{x + left, baseline + bottom}, color, {u1, v2}};
+            quad[3] = quad[2];
+            quad[4] = quad[1];
+            quad[5] = sf::Vertex{{x + right, baseline + bottom}, color, {u2, v2}};
+        }
 
-        return {findIndex(m_selStart.y) + m_selStart.x, findIndex(m_selEnd.y) + m_selEnd.x};
+        return vertices;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::deleteSelectedCharacters()
+    void TextBox::updateVisibleVertices(std::size_t firstLine, std::size_t lastLine) const
     {
-        if (m_selStart != m_selEnd)
+        if (m_visibleVerticesValid && (m_visibleVerticesFirstLine == firstLine) && (m_visibleVerticesLastLine == lastLine))
+            return;
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        const sf::Color selectedColor = Color::calcColorOpacity(m_selectedTextColorCached, m_opacityCached);
+
+        m_visibleVertices.clear();
+        for (std::size_t lineNumber = firstLine; lineNumber < lastLine; ++lineNumber)
         {
-            auto textSelectionPositions = findTextSelectionPositions();
+            const std::vector<sf::Vertex>& lineVertices = getLineVertices(lineNumber);
+            const std::size_t offset = m_visibleVertices.size();
+            m_visibleVertices.insert(m_visibleVertices.end(), lineVertices.begin(), lineVertices.end());
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            const float lineTop = static_cast<float>(lineNumber * m_lineHeight);
+            for (std::size_t i = offset; i < m_visibleVertices.size(); ++i)
+                m_visibleVertices[i].position.y += lineTop;
+
+            // Give the selected part of the line a different color
+            if ((selectionStart != selectionEnd) && (lineNumber >= selectionStart.y) && (lineNumber <= selectionEnd.y))
             {
-                m_text.erase(textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second);
-                m_selStart = m_selEnd;
+                const std::size_t selectedBegin = (lineNumber == selectionStart.y) ? selectionStart.x : 0;
+                const std::size_t selectedEnd = (lineNumber == selectionEnd.y) ? selectionEnd.x : m_lines[lineNumber].getSize();
+                for (std::size_t i = offset + (selectedBegin * 6); i < offset + (selectedEnd * 6); ++i)
+                    m_visibleVertices[i].color = selectedColor;
             }
+        }
+
+        m_visibleVerticesFirstLine = firstLine;
+        m_visibleVerticesLastLine = lastLine;
+        m_visibleVerticesValid = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::pair<std::size_t, std::size_t> TextBox::findTextSelectionPositions() const
+    {
+        return {m_lineStarts[m_selStart.y] + m_selStart.x, m_lineStarts[m_selEnd.y] + m_selEnd.x};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2<std::size_t> TextBox::findLinePosition(std::size_t textPosition) const
+    {
+        // Search the first line that ends at or behind the position
+        std::size_t low = 0;
+        std::size_t high = m_lines.size() - 1;
+        while (low < high)
+        {
+            const std::size_t mid = low + (high - low) / 2;
+            if (m_lineStarts[mid] + m_lines[mid].getSize() < textPosition)
+                low = mid + 1;
             else
-            {
-                m_text.erase(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first);
-                m_selEnd = m_selStart;
-            }
+                high = mid;
+        }
 
-            rearrangeText(true);
+        return {std::min(textPosition - m_lineStarts[low], m_lines[low].getSize()), low};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::lineEndsWithNewline(std::size_t lineNumber) const
+    {
+        return (lineNumber + 1 < m_lines.size()) && (m_lineStarts[lineNumber + 1] > m_lineStarts[lineNumber] + m_lines[lineNumber].getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::getTextLength() const
+    {
+        return m_lineStarts.back() + m_lines.back().getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextBox::getLinesText(std::size_t firstLine, std::size_t lastLine) const
+    {
+        if (firstLine >= lastLine)
+            return "";
+
+        std::basic_string<sf::Uint32> text;
+        text.reserve(m_lineStarts[lastLine - 1] + m_lines[lastLine - 1].getSize() - m_lineStarts[firstLine]);
+        for (std::size_t i = firstLine; i < lastLine; ++i)
+        {
+            text.append(m_lines[i].getData(), m_lines[i].getSize());
+            if ((i + 1 < lastLine) && lineEndsWithNewline(i))
+                text.push_back('\n');
         }
+
+        return text;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::rearrangeText(bool keepSelection)
+    sf::String TextBox::getTextPart(std::size_t position, std::size_t count) const
     {
-        // Don't continue when line height is 0 or when there is no font yet
+        if (count == 0)
+            return "";
+
+        const std::size_t firstLine = findLinePosition(position).y;
+        const std::size_t lastLine = findLinePosition(position + count).y;
+        return getLinesText(firstLine, lastLine + 1).substring(position - m_lineStarts[firstLine], count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::deleteSelectedCharacters()
+    {
+        if (m_selStart != m_selEnd)
+        {
+            auto textSelectionPositions = findTextSelectionPositions();
+            if (textSelectionPositions.first > textSelectionPositions.second)
+                std::swap(textSelectionPositions.first, textSelectionPositions.second);
+
+            replaceText(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first, "");
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::replaceText(std::size_t position, std::size_t count, const sf::String& insertion)
+    {
+        m_text = "";
+        m_textCached = false;
+
+        // Find the paragraphs in which characters are being replaced. Word wrap never moves characters past a newline,
+        // so only the lines of these paragraphs can change.
+        std::size_t firstLine = findLinePosition(position).y;
+        while ((firstLine > 0) && !lineEndsWithNewline(firstLine - 1))
+            --firstLine;
+
+        std::size_t lastLine = findLinePosition(position + count).y;
+        while ((lastLine + 1 < m_lines.size()) && !lineEndsWithNewline(lastLine))
+            ++lastLine;
+        ++lastLine;
+
+        const std::size_t paragraphsStart = m_lineStarts[firstLine];
+        sf::String paragraphs = getLinesText(firstLine, lastLine);
+        paragraphs.erase(position - paragraphsStart, count);
+        paragraphs.insert(position - paragraphsStart, insertion);
+
+        std::vector<sf::String> newLines;
+        std::vector<std::size_t> newLineStarts;
+        wrapText(paragraphs, paragraphsStart, newLines, newLineStarts);
+
+        // Replace the old lines and move the start positions of the lines behind them
+        const std::size_t oldLineCount = m_lines.size();
+        m_lines.erase(m_lines.begin() + firstLine, m_lines.begin() + lastLine);
+        m_lines.insert(m_lines.begin() + firstLine, std::make_move_iterator(newLines.begin()), std::make_move_iterator(newLines.end()));
+        m_lineStarts.erase(m_lineStarts.begin() + firstLine, m_lineStarts.begin() + lastLine);
+        m_lineStarts.insert(m_lineStarts.begin() + firstLine, newLineStarts.begin(), newLineStarts.end());
+        for (std::size_t i = firstLine + newLineStarts.size(); i < m_lineStarts.size(); ++i)
+            m_lineStarts[i] = m_lineStarts[i] + insertion.getSize() - count;
+
+        // The cached data of the other lines remains valid
+        replaceLineCache(m_lineCharPositions, oldLineCount, firstLine, lastLine, newLines.size());
+        replaceLineCache(m_lineVertices, oldLineCount, firstLine, lastLine, newLines.size());
+        m_visibleVerticesValid = false;
+        invalidateCachedBitmap();
+
+        m_selStart = findLinePosition(position + insertion.getSize());
+        m_selEnd = m_selStart;
+
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        // Find the maximum width of one line
-        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
-        if (m_verticalScroll->isShown())
-            maxLineWidth -= m_verticalScroll->getSize().x;
-
-        // Don't do anything when there is no room for the text
-        if (maxLineWidth <= 0)
+        // We may have to word wrap the entire text again if the scrollbar just appeared or disappeared
+        if (updateScrollbarMaximum())
+        {
+            rearrangeText(true);
             return;
+        }
 
-        // Store the current selection position when we are keeping the selection
-        std::pair<std::size_t, std::size_t> textSelectionPositions;
-        if (keepSelection)
-            textSelectionPositions = findTextSelectionPositions();
+        updateSelectionTexts();
+    }
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Split the string in multiple lines
-        m_lines.clear();
+    void TextBox::wrapText(const sf::String& text, std::size_t textOffset, std::vector<sf::String>& lines, std::vector<std::size_t>& lineStarts) const
+    {
+        // Find the maximum width of one line
+        float maxLineWidth = 0;
+        if ((m_lineHeight > 0) && (m_fontCached != nullptr))
+        {
+            const float textOffsetX = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+            maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffsetX;
+            if (m_verticalScroll->isShown())
+                maxLineWidth -= m_verticalScroll->getSize().x;
+        }
+
+        // Fit the text in the available space. When there is no room for the text then it is only split at the newlines.
+        const sf::String string = (maxLineWidth > 0) ? Text::wordWrap(maxLineWidth, text, m_fontCached, m_textSize, false, false) : text;
+
+        // Split the string in multiple lines. Word wrap only inserts newlines, so the position of each line in the original
+        // text is found by skipping the newlines that were already part of the text.
+        std::size_t textPos = 0;
         std::size_t searchPosStart = 0;
         std::size_t newLinePos = 0;
         while (newLinePos != sf::String::InvalidPos)
@@ -1130,61 +1305,60 @@ namespace tgui
             newLinePos = string.find('\n', searchPosStart);
 
             if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
+                lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
             else
-                m_lines.push_back(string.substring(searchPosStart));
+                lines.push_back(string.substring(searchPosStart));
+
+            lineStarts.push_back(textOffset + textPos);
+
+            textPos += lines.back().getSize();
+            if ((textPos < text.getSize()) && (text[textPos] == '\n'))
+                ++textPos;
 
             searchPosStart = newLinePos + 1;
         }
+    }
 
-        // Check if we should try to keep our selection
-        if (keepSelection)
-        {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
-
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-            {
-                index += m_lines[i].getSize();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                if (!newSelStartFound && (index >= textSelectionPositions.first))
-                {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.first), i);
+    bool TextBox::updateScrollbarMaximum()
+    {
+        // Tell the scrollbar how many pixels the text contains
+        const bool scrollbarShown = m_verticalScroll->isShown();
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
+        m_verticalScroll->setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight
+                                                              + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
+                                                              + Text::getExtraVerticalPadding(m_textSize)));
 
-                if (!newSelEndFound && (index >= textSelectionPositions.second))
-                {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.second), i);
+        return scrollbarShown != m_verticalScroll->isShown();
+    }
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
-            }
+    void TextBox::rearrangeText(bool keepSelection)
+    {
+        // Store the current selection position when we are keeping the selection
+        std::pair<std::size_t, std::size_t> textSelectionPositions;
+        if (keepSelection)
+            textSelectionPositions = findTextSelectionPositions();
 
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
-            {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
-            }
-            else // The text has changed too much, the selection can't be kept
-            {
-                m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-                m_selEnd = m_selStart;
-            }
+        // Split the entire text in lines again
+        const sf::String text = getText();
+        m_lines.clear();
+        m_lineStarts.clear();
+        wrapText(text, 0, m_lines, m_lineStarts);
+
+        // The cached character positions and vertices are no longer valid when the lines or the text size change
+        m_lineCharPositions.clear();
+        m_lineVertices.clear();
+        m_visibleVerticesValid = false;
+        invalidateCachedBitmap();
+
+        // Check if we should try to keep our selection
+        if (keepSelection)
+        {
+            m_selStart = findLinePosition(textSelectionPositions.first);
+            m_selEnd = findLinePosition(textSelectionPositions.second);
         }
         else // Set the caret at the back of the text
         {
@@ -1192,15 +1366,12 @@ namespace tgui
             m_selEnd = m_selStart;
         }
 
-        // Tell the scrollbar how many pixels the text contains
-        const bool scrollbarShown = m_verticalScroll->isShown();
-
-        m_verticalScroll->setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight
-                                                              + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
-                                                              + Text::getExtraVerticalPadding(m_textSize)));
+        // Don't continue when line height is 0 or when there is no font yet
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+            return;
 
         // We may have to recalculate what we just calculated if the scrollbar just appeared or disappeared
-        if (scrollbarShown != m_verticalScroll->isShown())
+        if (updateScrollbarMaximum())
         {
             rearrangeText(true);
             return;
@@ -1213,70 +1384,9 @@ namespace tgui
 
     void TextBox::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
-
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
-
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
+        // Only the colors of the visible characters have to change, which happens when the text box is drawn
+        m_visibleVerticesValid = false;
+        invalidateCachedBitmap();
 
         // Check if the caret is located above or below the view
         if (isVerticalScrollbarPresent())
@@ -1318,7 +1428,16 @@ namespace tgui
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
+
+            if (m_focused)
+                invalidateCachedBitmap();
         }
+
+        // The caret is only drawn when the widget is focused
+        if (m_focused)
+            scheduleRedraw(sf::milliseconds(500) - m_animationTimeElapsed);
+        else if (!m_possibleDoubleClick)
+            setUpdateNeeded(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1329,22 +1448,18 @@ namespace tgui
             return;
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-        sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
 
         // Position the caret
         {
-            tempText.setString(m_lines[m_selEnd.y].substring(0, m_selEnd.x));
-
             float kerning = 0;
             if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
                 kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x-1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
 
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
+            m_caretPosition = {textOffset + getLineCharacterPositions(m_selEnd.y)[m_selEnd.x] + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
 
-        // Calculate the position of the text objects
+        // Calculate the selection rectangles
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
         if (m_selStart != m_selEnd)
         {
             auto selectionStart = m_selStart;
@@ -1361,64 +1476,36 @@ namespace tgui
             if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
                 kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
 
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+            const std::vector<float>& selectionStartLinePositions = getLineCharacterPositions(selectionStart.y);
+            const std::vector<float>& selectionEndLinePositions = getLineCharacterPositions(selectionEnd.y);
+            const float selectionStartPos = selectionStartLinePositions[selectionStart.x] + kerningSelectionStart;
+            const float selectionEndPos = selectionEndLinePositions[selectionEnd.x] + kerningSelectionEnd;
 
-            // Recalculate the selection rectangles
             {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+                m_selectionRects.push_back({textOffset + selectionStartPos, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
 
                 if (!m_lines[selectionStart.y].isEmpty())
                 {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
-
                     // There is kerning when the selection is on just this line
                     if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
+                        m_selectionRects.back().width = selectionEndPos - selectionStartPos;
+                    else
+                        m_selectionRects.back().width = selectionStartLinePositions.back() - selectionStartPos;
                 }
 
                 for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
                 {
                     m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+                    m_selectionRects.push_back({0, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
 
                     if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
+                        m_selectionRects.back().width += getLineCharacterPositions(i).back();
                 }
 
                 if (selectionStart.y != selectionEnd.y)
                 {
                     m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != "")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+                    m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset + selectionEndPos, static_cast<float>(m_lineHeight)});
                 }
             }
         }
@@ -1462,6 +1549,28 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::reportMemoryUsage(MemoryUsage& usage) const
+    {
+        Widget::reportMemoryUsage(usage);
+
+        usage.addString(m_text);
+        for (const auto& line : m_lines)
+            usage.addString(line);
+
+        usage.addWidgetBytes(m_lineStarts.capacity() * sizeof(std::size_t));
+
+        for (const auto& charPositions : m_lineCharPositions)
+            usage.addWidgetBytes(charPositions.capacity() * sizeof(float));
+
+        for (const auto& vertices : m_lineVertices)
+            usage.addWidgetBytes(vertices.capacity() * sizeof(sf::Vertex));
+
+        usage.addWidgetBytes(m_visibleVertices.capacity() * sizeof(sf::Vertex));
+        usage.addWidget(*m_verticalScroll);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::rendererChanged(const std::string& property)
     {
         if (property == "borders")
@@ -1476,14 +1585,14 @@ namespace tgui
         }
         else if (property == "textcolor")
         {
-            m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
-            m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
+            m_textColorCached = getSharedRenderer()->getTextColor();
+            m_lineVertices.clear();
+            m_visibleVerticesValid = false;
         }
         else if (property == "selectedtextcolor")
         {
-            m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
-            m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
+            m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
+            m_visibleVerticesValid = false;
         }
         else if (property == "texturebackground")
         {
@@ -1525,21 +1634,12 @@ namespace tgui
 
             m_verticalScroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            m_textBeforeSelection.setOpacity(m_opacityCached);
-            m_textAfterSelection1.setOpacity(m_opacityCached);
-            m_textAfterSelection2.setOpacity(m_opacityCached);
-            m_textSelection1.setOpacity(m_opacityCached);
-            m_textSelection2.setOpacity(m_opacityCached);
+            m_lineVertices.clear();
+            m_visibleVerticesValid = false;
         }
         else if (property == "font")
         {
             Widget::rendererChanged(property);
-
-            m_textBeforeSelection.setFont(m_fontCached);
-            m_textSelection1.setFont(m_fontCached);
-            m_textSelection2.setFont(m_fontCached);
-            m_textAfterSelection1.setFont(m_fontCached);
-            m_textAfterSelection2.setFont(m_fontCached);
             setTextSize(getTextSize());
         }
         else
@@ -1617,22 +1717,46 @@ namespace tgui
             // Move the text according to the vertical scrollar
             states.transform.translate({0, -static_cast<float>(m_verticalScroll->getValue())});
 
+            // Only the lines that lie (partially) inside the clipping area are drawn. The descent of the characters can reach
+            // slightly into the next line, so the line above the visible area is included when it might still be seen.
+            const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
+            const float visibleTop = std::max(0.f, m_verticalScroll->getValue() - extraVerticalSpace);
+            const float visibleBottom = m_verticalScroll->getValue() + getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+            std::size_t firstLine = 0;
+            std::size_t lastLine = 0;
+            if (m_lineHeight > 0)
+            {
+                firstLine = std::min(static_cast<std::size_t>(visibleTop / m_lineHeight), m_lines.size());
+                lastLine = std::min(static_cast<std::size_t>(std::ceil(visibleBottom / m_lineHeight)), m_lines.size());
+            }
+
             // Draw the background of the selected text
             for (const auto& selectionRect : m_selectionRects)
             {
+                if ((selectionRect.top + selectionRect.height + extraVerticalSpace < visibleTop) || (selectionRect.top > visibleBottom))
+                    continue;
+
                 states.transform.translate({selectionRect.left, selectionRect.top});
-                drawRectangleShape(target, states, {selectionRect.width, selectionRect.height + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)}, m_selectedTextBackgroundColorCached);
+                drawRectangleShape(target, states, {selectionRect.width, selectionRect.height + extraVerticalSpace}, m_selectedTextBackgroundColorCached);
                 states.transform.translate({-selectionRect.left, -selectionRect.top});
             }
 
             // Draw the text
-            m_textBeforeSelection.draw(target, states);
-            if (m_selStart != m_selEnd)
+            if (m_fontCached && (firstLine < lastLine))
             {
-                m_textSelection1.draw(target, states);
-                m_textSelection2.draw(target, states);
-                m_textAfterSelection1.draw(target, states);
-                m_textAfterSelection2.draw(target, states);
+                updateVisibleVertices(firstLine, lastLine);
+
+                sf::RenderStates textStates = states;
+                textStates.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize), 0});
+
+                // Round the position to avoid blurry text
+                const float* matrix = textStates.transform.getMatrix();
+                textStates.transform = sf::Transform{matrix[0], matrix[4], std::round(matrix[12]),
+                                                     matrix[1], matrix[5], std::floor(matrix[13]),
+                                                     matrix[3], matrix[7], matrix[15]};
+
+                textStates.texture = &m_fontCached.getFont()->getTexture(m_textSize);
+                priv::drawVertices(target, m_visibleVertices.data(), m_visibleVertices.size(), sf::PrimitiveType::Triangles, textStates);
             }
 
             // Only draw the caret when needed
@@ -45,7 +45,7 @@ namespace tgui
 
     VerticalLayout::Ptr VerticalLayout::create(const Layout2d& size)
     {
-        return std::make_shared<VerticalLayout>(size);
+        return makePooled<VerticalLayout>(size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,4 +199,100 @@ TEST_CASE("[Animation]") {
 
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
+
+    SECTION("Easing") {
+        for (auto easing : {tgui::EasingType::Linear, tgui::EasingType::EaseIn, tgui::EasingType::EaseOut,
+                            tgui::EasingType::EaseInOut, tgui::EasingType::EaseOutBack})
+        {
+            REQUIRE(tgui::applyEasing(easing, 0) == Approx(0));
+            REQUIRE(tgui::applyEasing(easing, 1) == Approx(1));
+        }
+
+        REQUIRE(tgui::applyEasing(tgui::EasingType::Linear, 0.25f) == Approx(0.25f));
+        REQUIRE(tgui::applyEasing(tgui::EasingType::EaseIn, 0.5f) == Approx(0.125f));
+        REQUIRE(tgui::applyEasing(tgui::EasingType::EaseOut, 0.5f) == Approx(0.875f));
+        REQUIRE(tgui::applyEasing(tgui::EasingType::EaseInOut, 0.5f) == Approx(0.5f));
+        REQUIRE(tgui::applyEasing(tgui::EasingType::EaseOutBack, 0.7f) > 1);
+    }
+
+    SECTION("Property animations") {
+        SECTION("moveWithAnimation") {
+            widget->moveWithAnimation({130, 15}, sf::milliseconds(200), tgui::EasingType::EaseIn);
+            widget->update(sf::milliseconds(100));
+            REQUIRE(compareVector2f(widget->getPosition(), {30 + 100*0.125f, 15}));
+            widget->update(sf::milliseconds(150));
+            REQUIRE(widget->getPosition() == sf::Vector2f(130, 15));
+        }
+
+        SECTION("resizeWithAnimation") {
+            widget->resizeWithAnimation({220, 50}, sf::milliseconds(200));
+            widget->update(sf::milliseconds(50));
+            REQUIRE(compareVector2f(widget->getSize(), {145, 35}));
+            widget->update(sf::milliseconds(150));
+            REQUIRE(widget->getSize() == sf::Vector2f(220, 50));
+        }
+
+        SECTION("fadeWithAnimation") {
+            widget->fadeWithAnimation(0.1f, sf::milliseconds(200));
+            widget->update(sf::milliseconds(100));
+            REQUIRE(widget->getInheritedOpacity() == Approx(0.5f));
+            widget->update(sf::milliseconds(100));
+            REQUIRE(widget->getInheritedOpacity() == Approx(0.1f));
+        }
+
+        SECTION("animateRendererColor") {
+            parent->getRenderer()->setBackgroundColor({0, 0, 0});
+            parent->animateRendererColor("BackgroundColor", {200, 100, 50}, sf::milliseconds(200));
+            parent->update(sf::milliseconds(100));
+            REQUIRE(parent->getRenderer()->getBackgroundColor() == tgui::Color(100, 50, 25));
+            parent->update(sf::milliseconds(100));
+            REQUIRE(parent->getRenderer()->getBackgroundColor() == tgui::Color(200, 100, 50));
+        }
+
+        SECTION("Animating the same property twice finishes the first animation") {
+            widget->moveWithAnimation({130, 15}, sf::milliseconds(200));
+            widget->update(sf::milliseconds(100));
+            widget->moveWithAnimation({130, 115}, sf::milliseconds(200));
+            REQUIRE(widget->getPosition() == sf::Vector2f(130, 15));
+            widget->update(sf::milliseconds(100));
+            REQUIRE(compareVector2f(widget->getPosition(), {130, 65}));
+        }
+    }
+
+    SECTION("Animations inside gui") {
+        tgui::Gui gui;
+        gui.add(parent);
+
+        widget->moveWithAnimation({130, 15}, sf::milliseconds(200));
+        REQUIRE(gui.getContainer()->getAnimationScheduler().isAnimating());
+
+        // The animation is only advanced once per frame
+        gui.updateTime(sf::milliseconds(50));
+        REQUIRE(compareVector2f(widget->getPosition(), {55, 15}));
+
+        SECTION("Animation finishes") {
+            gui.updateTime(sf::milliseconds(150));
+            REQUIRE(widget->getPosition() == sf::Vector2f(130, 15));
+            gui.updateTime(sf::milliseconds(50));
+            REQUIRE(!gui.getContainer()->getAnimationScheduler().isAnimating());
+        }
+
+        SECTION("Hidden widgets are paused") {
+            parent->setVisible(false);
+            gui.updateTime(sf::milliseconds(50));
+            REQUIRE(compareVector2f(widget->getPosition(), {55, 15}));
+            REQUIRE(!gui.getContainer()->getAnimationScheduler().isAnimating());
+            parent->setVisible(true);
+            REQUIRE(gui.getContainer()->getAnimationScheduler().isAnimating());
+            gui.updateTime(sf::milliseconds(50));
+            REQUIRE(compareVector2f(widget->getPosition(), {80, 15}));
+        }
+
+        SECTION("Removed widgets are no longer animated by the gui") {
+            gui.remove(parent);
+            gui.updateTime(sf::milliseconds(50));
+            REQUIRE(compareVector2f(widget->getPosition(), {55, 15}));
+            REQUIRE(!gui.getContainer()->getAnimationScheduler().isAnimating());
+        }
+    }
 }
@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/CircleShape.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
+
+TEST_CASE("[CircleShape]")
+{
+    tgui::CircleShape circle;
+
+    SECTION("Properties")
+    {
+        REQUIRE(circle.getRadius() == 0);
+        REQUIRE(circle.getPointCount() == 30);
+        REQUIRE(circle.getFillColor() == sf::Color::White);
+        REQUIRE(circle.getOutlineColor() == sf::Color::White);
+        REQUIRE(circle.getOutlineThickness() == 0);
+
+        circle.setRadius(20);
+        circle.setPointCount(12);
+        circle.setFillColor(sf::Color::Red);
+        circle.setOutlineColor(sf::Color::Green);
+        circle.setOutlineThickness(3);
+
+        REQUIRE(circle.getRadius() == 20);
+        REQUIRE(circle.getPointCount() == 12);
+        REQUIRE(circle.getFillColor() == sf::Color::Red);
+        REQUIRE(circle.getOutlineColor() == sf::Color::Green);
+        REQUIRE(circle.getOutlineThickness() == 3);
+    }
+
+    SECTION("Drawing")
+    {
+        tgui::RecordingRenderTarget target{{100, 100}};
+
+        circle.setRadius(10);
+        circle.setFillColor(sf::Color::Red);
+
+        SECTION("Fill only")
+        {
+            circle.draw(target, {});
+            const auto& commands = target.getCommands();
+            REQUIRE(commands.size() == 1);
+            REQUIRE(commands[0].primitiveType == sf::PrimitiveType::TrianglesFan);
+            REQUIRE(commands[0].vertices.size() == 32);
+
+            // The first vertex lies in the center, the second one at the top of the circle
+            REQUIRE(commands[0].vertices[0].position == sf::Vector2f(10, 10));
+            REQUIRE(commands[0].vertices[1].position.x == Approx(10));
+            REQUIRE(commands[0].vertices[1].position.y == Approx(0).margin(0.0001));
+            REQUIRE(commands[0].vertices[0].color == sf::Color::Red);
+        }
+
+        SECTION("With outline")
+        {
+            circle.setOutlineThickness(2);
+            circle.setOutlineColor(sf::Color::Blue);
+            circle.draw(target, {});
+
+            const auto& commands = target.getCommands();
+            REQUIRE(commands.size() == 2);
+            REQUIRE(commands[1].primitiveType == sf::PrimitiveType::TrianglesStrip);
+            REQUIRE(commands[1].vertices.size() == 62);
+            REQUIRE(commands[1].vertices[0].color == sf::Color::Blue);
+        }
+
+        SECTION("Transparent fill")
+        {
+            circle.setFillColor(sf::Color::Transparent);
+            circle.setOutlineThickness(2);
+            circle.draw(target, {});
+
+            const auto& commands = target.getCommands();
+            REQUIRE(commands.size() == 1);
+            REQUIRE(commands[0].primitiveType == sf::PrimitiveType::TrianglesStrip);
+        }
+
+        SECTION("Color changes keep the geometry")
+        {
+            circle.draw(target, {});
+            circle.setFillColor(sf::Color::Yellow);
+            circle.draw(target, {});
+
+            const auto& commands = target.getCommands();
+            REQUIRE(commands.size() == 2);
+            REQUIRE(commands[0].vertices.size() == commands[1].vertices.size());
+            for (std::size_t i = 0; i < commands[0].vertices.size(); ++i)
+                REQUIRE(commands[0].vertices[i].position == commands[1].vertices[i].position);
+            REQUIRE(commands[1].vertices[0].color == sf::Color::Yellow);
+        }
+    }
+}
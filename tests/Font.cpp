@@ -35,4 +35,23 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("PreloadGlyphs")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        const sf::Vector2u initialTextureSize = font.getFont()->getTexture(97).getSize();
+
+        // The texture has to grow to fit all printable ASCII characters at this size
+        font.preloadGlyphs(0x20, 0x7E, 97);
+        const sf::Vector2u textureSize = font.getFont()->getTexture(97).getSize();
+        REQUIRE(textureSize.x * textureSize.y > initialTextureSize.x * initialTextureSize.y);
+
+        // Preloading characters that were already loaded doesn't change anything
+        font.preloadGlyphs("Hello", 97);
+        REQUIRE(font.getFont()->getTexture(97).getSize() == textureSize);
+
+        // Preloading without a font does nothing
+        tgui::Font().preloadGlyphs("Hello", 97);
+        tgui::Font().preloadGlyphs(0x20, 0x7E, 97, true, 1);
+    }
 }
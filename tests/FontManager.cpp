@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/FontManager.hpp>
+#include <TGUI/Font.hpp>
+#include <fstream>
+#include <iterator>
+
+TEST_CASE("[FontManager]")
+{
+    SECTION("From file")
+    {
+        auto font1 = tgui::FontManager::getFontFromFile("resources/DejaVuSans.ttf");
+        auto font2 = tgui::FontManager::getFontFromFile("resources/DejaVuSans.ttf");
+        REQUIRE(font1 != nullptr);
+        REQUIRE(font1 == font2);
+
+        // The deserializer also shares the font
+        REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() == font1);
+
+        // Fonts that failed to load are not reused
+        auto invalidFont1 = tgui::FontManager::getFontFromFile("resources/NonExistent.ttf");
+        auto invalidFont2 = tgui::FontManager::getFontFromFile("resources/NonExistent.ttf");
+        REQUIRE(invalidFont1 != nullptr);
+        REQUIRE(invalidFont1 != invalidFont2);
+    }
+
+    SECTION("From memory")
+    {
+        std::ifstream file{"resources/DejaVuSans.ttf", std::ios::binary};
+        const std::vector<char> data1{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        const std::vector<char> data2 = data1;
+        REQUIRE(!data1.empty());
+
+        // The same contents result in the same font, even when stored in a different buffer
+        auto font1 = tgui::FontManager::getFontFromMemory(data1.data(), data1.size());
+        auto font2 = tgui::FontManager::getFontFromMemory(data2.data(), data2.size());
+        REQUIRE(font1 == font2);
+        REQUIRE(tgui::Font(data2.data(), data2.size()).getFont() == font1);
+
+        // Once the font is no longer used, it is loaded again
+        const std::size_t fontCount = tgui::FontManager::getFontCount();
+        font1 = nullptr;
+        font2 = nullptr;
+        REQUIRE(tgui::FontManager::getFontCount() == fontCount - 1);
+
+        font1 = tgui::FontManager::getFontFromMemory(data1.data(), data1.size());
+        REQUIRE(font1 != nullptr);
+        REQUIRE(tgui::FontManager::getFontCount() == fontCount);
+
+        // The data is copied, so the buffer that was passed first can be freed while the font is still shared
+        font1 = nullptr;
+        auto tempData = std::make_unique<std::vector<char>>(data1);
+        font1 = tgui::FontManager::getFontFromMemory(tempData->data(), tempData->size());
+        tempData = nullptr;
+        font2 = tgui::FontManager::getFontFromMemory(data2.data(), data2.size());
+        REQUIRE(font1 == font2);
+        REQUIRE(font2->getGlyph('A', 20, false).advance > 0);
+    }
+
+    SECTION("Copy")
+    {
+        // A font loaded by the manager is shared instead of copied
+        auto font = tgui::FontManager::getFontFromFile("resources/DejaVuSans.ttf");
+        REQUIRE(tgui::FontManager::getFontCopy(*font) == font);
+        REQUIRE(tgui::Font(*font).getFont() == font);
+
+        // Other fonts are copied
+        sf::Font ownFont;
+        REQUIRE(ownFont.loadFromFile("resources/DejaVuSans.ttf"));
+        auto copiedFont = tgui::FontManager::getFontCopy(ownFont);
+        REQUIRE(copiedFont != nullptr);
+        REQUIRE(copiedFont.get() != &ownFont);
+        REQUIRE(copiedFont != font);
+    }
+}
@@ -0,0 +1,401 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/ToolTip.hpp>
+
+namespace
+{
+    sf::Event createMouseMoveEvent(int x, int y)
+    {
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    }
+}
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(200, 200);
+    tgui::Gui gui{target};
+
+    SECTION("Event queue")
+    {
+        auto button = tgui::Button::create();
+        button->setSize(100, 100);
+        gui.add(button);
+
+        unsigned int mouseEnterCount = 0;
+        unsigned int mouseLeaveCount = 0;
+        button->connect("MouseEntered", [&]{ ++mouseEnterCount; });
+        button->connect("MouseLeft", [&]{ ++mouseLeaveCount; });
+
+        REQUIRE(!gui.isEventQueueEnabled());
+        gui.setEventQueueEnabled(true);
+        REQUIRE(gui.isEventQueueEnabled());
+
+        SECTION("Mouse moves are merged")
+        {
+            for (int i = 0; i < 10; ++i)
+                REQUIRE(!gui.handleEvent(createMouseMoveEvent(10 + i, 10)));
+
+            REQUIRE(mouseEnterCount == 0);
+            gui.handleQueuedEvents();
+            REQUIRE(mouseEnterCount == 1);
+            REQUIRE(gui.getEventQueueStats().received == 10);
+            REQUIRE(gui.getEventQueueStats().merged == 9);
+            REQUIRE(gui.getEventQueueStats().dispatched == 1);
+
+            // Only the last position is used, so the button is never entered when the mouse ends outside of it
+            gui.handleEvent(createMouseMoveEvent(150, 150));
+            gui.handleEvent(createMouseMoveEvent(50, 50));
+            gui.handleEvent(createMouseMoveEvent(150, 150));
+            gui.handleQueuedEvents();
+            REQUIRE(mouseLeaveCount == 1);
+            REQUIRE(mouseEnterCount == 1);
+            REQUIRE(gui.getEventQueueStats().dispatched == 1);
+        }
+
+        SECTION("Events are not reordered")
+        {
+            unsigned int pressCount = 0;
+            button->connect("Pressed", [&]{ ++pressCount; });
+
+            sf::Event event;
+            event.type = sf::Event::MouseButtonPressed;
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = 50;
+            event.mouseButton.y = 50;
+
+            gui.handleEvent(createMouseMoveEvent(40, 40));
+            gui.handleEvent(createMouseMoveEvent(50, 50));
+            gui.handleEvent(event);
+            event.type = sf::Event::MouseButtonReleased;
+            gui.handleEvent(event);
+            gui.handleEvent(createMouseMoveEvent(150, 150));
+            gui.handleEvent(createMouseMoveEvent(160, 160));
+            REQUIRE(gui.handleQueuedEvents());
+
+            REQUIRE(pressCount == 1);
+            REQUIRE(mouseEnterCount == 1);
+            REQUIRE(mouseLeaveCount == 1);
+            REQUIRE(gui.getEventQueueStats().received == 6);
+            REQUIRE(gui.getEventQueueStats().merged == 2);
+            REQUIRE(gui.getEventQueueStats().dispatched == 4);
+        }
+
+        SECTION("Wheel scrolls are merged")
+        {
+            sf::Event event;
+            event.type = sf::Event::MouseWheelScrolled;
+            event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+            event.mouseWheelScroll.delta = 1;
+            event.mouseWheelScroll.x = 50;
+            event.mouseWheelScroll.y = 50;
+            gui.handleEvent(event);
+            gui.handleEvent(event);
+
+            event.mouseWheelScroll.x = 60;
+            gui.handleEvent(event);
+
+            gui.handleQueuedEvents();
+            REQUIRE(gui.getEventQueueStats().received == 3);
+            REQUIRE(gui.getEventQueueStats().merged == 1);
+            REQUIRE(gui.getEventQueueStats().dispatched == 2);
+        }
+
+        SECTION("Touch moves are merged per finger")
+        {
+            sf::Event event;
+            event.type = sf::Event::TouchMoved;
+            for (int i = 0; i < 4; ++i)
+            {
+                event.touch.finger = 0;
+                event.touch.x = 10 + i;
+                event.touch.y = 10;
+                gui.handleEvent(event);
+
+                event.touch.finger = 1;
+                event.touch.x = 150 + i;
+                event.touch.y = 150;
+                gui.handleEvent(event);
+            }
+
+            gui.handleQueuedEvents();
+            REQUIRE(gui.getEventQueueStats().received == 8);
+            REQUIRE(gui.getEventQueueStats().merged == 6);
+            REQUIRE(gui.getEventQueueStats().dispatched == 2);
+        }
+
+        SECTION("Queued events are handled when drawing")
+        {
+            gui.handleEvent(createMouseMoveEvent(50, 50));
+            gui.draw();
+            REQUIRE(mouseEnterCount == 1);
+        }
+
+        SECTION("Disabling the queue handles the queued events")
+        {
+            gui.handleEvent(createMouseMoveEvent(50, 50));
+            gui.setEventQueueEnabled(false);
+            REQUIRE(mouseEnterCount == 1);
+
+            gui.handleEvent(createMouseMoveEvent(150, 150));
+            REQUIRE(mouseLeaveCount == 1);
+        }
+    }
+
+    SECTION("Tab order")
+    {
+        auto button1 = tgui::Button::create();
+        auto group = tgui::Group::create();
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        gui.add(button1);
+        gui.add(group);
+        group->add(button2);
+        gui.add(button3);
+
+        gui.focusNextWidget();
+        REQUIRE(button1->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(button2->isFocused());
+        REQUIRE(!button1->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(button3->isFocused());
+        REQUIRE(!button2->isFocused());
+        REQUIRE(!group->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(button1->isFocused());
+        gui.focusPreviousWidget();
+        REQUIRE(button3->isFocused());
+
+        // The tab order is updated when widgets are added or hidden
+        auto button4 = tgui::Button::create();
+        group->add(button4);
+        button1->setVisible(false);
+        gui.focusPreviousWidget();
+        REQUIRE(button4->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(button3->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(button2->isFocused());
+
+        // Isolated containers like panels are skipped, unless the focus is already inside them
+        auto panel = tgui::Panel::create();
+        auto button5 = tgui::Button::create();
+        auto button6 = tgui::Button::create();
+        gui.add(panel);
+        panel->add(button5);
+        panel->add(button6);
+        gui.focusPreviousWidget();
+        REQUIRE(button3->isFocused());
+
+        button5->setFocused(true);
+        gui.focusNextWidget();
+        REQUIRE(button6->isFocused());
+        gui.focusNextWidget();
+        REQUIRE(button5->isFocused());
+    }
+
+    SECTION("Key events reach the focused widget")
+    {
+        // Containers that override keyPressed still see the key events of their children
+        struct KeyRecordingGroup : public tgui::Group
+        {
+            void keyPressed(const sf::Event::KeyEvent& event) override
+            {
+                ++keysPressed;
+                tgui::Group::keyPressed(event);
+            }
+
+            unsigned int keysPressed = 0;
+        };
+
+        auto panel = tgui::Panel::create();
+        auto group = std::make_shared<KeyRecordingGroup>();
+        auto editBox = tgui::EditBox::create();
+        gui.add(panel);
+        panel->add(group);
+        group->add(editBox);
+
+        sf::Event event;
+        event.type = sf::Event::TextEntered;
+        event.text.unicode = 'A';
+        REQUIRE(!gui.handleEvent(event));
+
+        editBox->setFocused(true);
+        REQUIRE(gui.handleEvent(event));
+        REQUIRE(gui.handleEvent(event));
+        REQUIRE(editBox->getText() == "AA");
+
+        event.type = sf::Event::KeyPressed;
+        event.key.code = sf::Keyboard::BackSpace;
+        event.key.alt = false;
+        event.key.control = false;
+        event.key.shift = false;
+        event.key.system = false;
+        REQUIRE(gui.handleEvent(event));
+        REQUIRE(editBox->getText() == "A");
+        REQUIRE(group->keysPressed == 1);
+
+        // Once the widget loses focus, the events are no longer passed to it
+        group->remove(editBox);
+        event.type = sf::Event::TextEntered;
+        gui.handleEvent(event);
+        REQUIRE(editBox->getText() == "A");
+    }
+
+    SECTION("Redraw needed")
+    {
+        REQUIRE(gui.isRedrawNeeded());
+        gui.draw();
+        REQUIRE(!gui.isRedrawNeeded());
+        REQUIRE(gui.getTimeUntilNextChange() > sf::seconds(3600));
+
+        auto button = tgui::Button::create();
+        button->setSize(100, 100);
+        gui.add(button);
+        REQUIRE(gui.isRedrawNeeded());
+        REQUIRE(gui.getTimeUntilNextChange() == sf::Time::Zero);
+        gui.draw();
+        REQUIRE(!gui.isRedrawNeeded());
+
+        SECTION("Hover")
+        {
+            gui.handleEvent(createMouseMoveEvent(150, 150));
+            REQUIRE(!gui.isRedrawNeeded());
+            gui.handleEvent(createMouseMoveEvent(50, 50));
+            REQUIRE(gui.isRedrawNeeded());
+
+            // Moving the mouse doesn't change the looks of the button while the mouse stays on top of it
+            gui.draw();
+            gui.handleEvent(createMouseMoveEvent(60, 60));
+            REQUIRE(!gui.isRedrawNeeded());
+        }
+
+        SECTION("Property change")
+        {
+            button->getRenderer()->setTextColor(sf::Color::Red);
+            REQUIRE(gui.isRedrawNeeded());
+        }
+
+        SECTION("requestRedraw")
+        {
+            gui.requestRedraw();
+            REQUIRE(gui.isRedrawNeeded());
+        }
+
+        SECTION("Caret blink")
+        {
+            auto editBox = tgui::EditBox::create();
+            gui.add(editBox);
+            editBox->setFocused(true);
+            gui.draw();
+            REQUIRE(!gui.isRedrawNeeded());
+            REQUIRE(gui.getTimeUntilNextChange() > sf::Time::Zero);
+            REQUIRE(gui.getTimeUntilNextChange() <= sf::milliseconds(500));
+
+            gui.updateTime(sf::milliseconds(500));
+            REQUIRE(gui.isRedrawNeeded());
+        }
+
+        SECTION("Tool tip")
+        {
+            button->setToolTip(tgui::Button::create("Tip"));
+            gui.handleEvent(createMouseMoveEvent(50, 50));
+            gui.draw();
+            REQUIRE(!gui.isRedrawNeeded());
+            REQUIRE(gui.getTimeUntilNextChange() <= tgui::ToolTip::getTimeToDisplay());
+
+            gui.updateTime(tgui::ToolTip::getTimeToDisplay());
+            REQUIRE(gui.isRedrawNeeded());
+        }
+
+        SECTION("Animation")
+        {
+            button->moveWithAnimation({50, 50}, sf::milliseconds(300));
+            gui.draw();
+            REQUIRE(gui.getTimeUntilNextChange() == sf::Time::Zero);
+            REQUIRE(gui.isRedrawNeeded());
+        }
+    }
+
+    SECTION("Only widgets that need it are updated")
+    {
+        struct UpdateCountingButton : public tgui::Button
+        {
+            using tgui::Button::setUpdateNeeded;
+
+            void update(sf::Time elapsedTime) override
+            {
+                ++updateCount;
+                tgui::Button::update(elapsedTime);
+            }
+
+            unsigned int updateCount = 0;
+        };
+
+        auto panel = tgui::Panel::create();
+        auto button = std::make_shared<UpdateCountingButton>();
+        gui.add(panel);
+        panel->add(button);
+
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(button->updateCount == 0);
+
+        button->setUpdateNeeded(true);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(button->updateCount == 1);
+
+        // Widgets inside hidden containers are paused
+        panel->setVisible(false);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(button->updateCount == 1);
+        panel->setVisible(true);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(button->updateCount == 2);
+
+        button->setUpdateNeeded(false);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(button->updateCount == 2);
+
+        // Widgets that still need to be updated are updated again when they are added to the gui again
+        button->setUpdateNeeded(true);
+        gui.remove(panel);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(button->updateCount == 2);
+        gui.add(panel);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(button->updateCount == 3);
+    }
+}
@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/InputValidator.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+
+TEST_CASE("[InputValidator]")
+{
+    SECTION("Default")
+    {
+        tgui::InputValidator validator;
+        REQUIRE(validator.getPattern() == ".*");
+        REQUIRE(validator.acceptsEverything());
+        REQUIRE(validator.isIncremental());
+        REQUIRE(validator.validate(""));
+        REQUIRE(validator.validate(L"Some Ê text"));
+    }
+
+    SECTION("Predefined validators")
+    {
+        tgui::InputValidator intValidator{tgui::EditBox::Validator::Int};
+        REQUIRE(intValidator.isIncremental());
+        REQUIRE(!intValidator.acceptsEverything());
+        REQUIRE(intValidator.validate(""));
+        REQUIRE(intValidator.validate("-"));
+        REQUIRE(intValidator.validate("+25"));
+        REQUIRE(!intValidator.validate("2-5"));
+        REQUIRE(!intValidator.validate("1.5"));
+
+        tgui::InputValidator uintValidator{tgui::EditBox::Validator::UInt};
+        REQUIRE(uintValidator.validate(""));
+        REQUIRE(uintValidator.validate("0123"));
+        REQUIRE(!uintValidator.validate("-5"));
+        REQUIRE(!uintValidator.validate(L"٥")); // Arabic-indic digit
+
+        tgui::InputValidator floatValidator{tgui::EditBox::Validator::Float};
+        REQUIRE(floatValidator.validate("-."));
+        REQUIRE(floatValidator.validate("-2.50"));
+        REQUIRE(floatValidator.validate(".001"));
+        REQUIRE(!floatValidator.validate("1.2.3"));
+        REQUIRE(!floatValidator.validate("1-2"));
+    }
+
+    SECTION("Compiled patterns")
+    {
+        tgui::InputValidator validator{"[a-zA-Z_][a-zA-Z0-9_]*"};
+        REQUIRE(validator.isIncremental());
+        REQUIRE(validator.validate("_name2"));
+        REQUIRE(!validator.validate("2name"));
+        REQUIRE(!validator.validate(""));
+
+        validator = tgui::InputValidator{"(ab|c)+d?"};
+        REQUIRE(validator.isIncremental());
+        REQUIRE(validator.validate("abcab"));
+        REQUIRE(validator.validate("ccd"));
+        REQUIRE(!validator.validate("abd d"));
+        REQUIRE(!validator.validate("d"));
+
+        validator = tgui::InputValidator{"^\\d{2,3}(?:-\\d{2})?$"};
+        REQUIRE(validator.isIncremental());
+        REQUIRE(validator.validate("12"));
+        REQUIRE(validator.validate("123-45"));
+        REQUIRE(!validator.validate("1"));
+        REQUIRE(!validator.validate("1234"));
+        REQUIRE(!validator.validate("123-4"));
+
+        validator = tgui::InputValidator{"[^\\s]*\\.?"};
+        REQUIRE(validator.validate(L"Ê中."));
+        REQUIRE(!validator.validate(L"a　b"));
+
+        validator = tgui::InputValidator{u8"[à-é]*"};
+        REQUIRE(validator.validate(L"àé"));
+        REQUIRE(!validator.validate(L"ê"));
+    }
+
+    SECTION("Incremental validation")
+    {
+        tgui::InputValidator validator{"[0-9]+x?"};
+        tgui::InputValidator::State state = validator.getStartState();
+        REQUIRE(!validator.isAccepting(state));
+
+        state = validator.advance(state, '5');
+        REQUIRE(validator.isAccepting(state));
+
+        state = validator.advance(state, 'x');
+        REQUIRE(validator.isAccepting(state));
+
+        state = validator.advance(state, 'x');
+        REQUIRE(state == tgui::InputValidator::DeadState);
+        REQUIRE(!validator.isAccepting(state));
+
+        state = validator.advance(state, '5');
+        REQUIRE(state == tgui::InputValidator::DeadState);
+    }
+
+    SECTION("Fallback to std::regex")
+    {
+        tgui::InputValidator validator{"(a+)b\\1"};
+        REQUIRE(!validator.isIncremental());
+        REQUIRE(validator.validate("aabaa"));
+        REQUIRE(!validator.validate("aaba"));
+
+        REQUIRE_THROWS_AS(tgui::InputValidator{"(a"}, std::regex_error);
+    }
+}
@@ -0,0 +1,125 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Loading/FormLoader.hpp>
+#include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <atomic>
+#include <fstream>
+
+TEST_CASE("[FormLoader]")
+{
+    {
+        std::ofstream out{"FormLoaderFile.txt"};
+        out << "Picture.Pic1 {\n"
+               "    Renderer { Texture = \"resources/image.png\"; }\n"
+               "}\n"
+               "Picture.Pic2 {\n"
+               "    Renderer { Texture = \"resources/image.png\" Part(0, 0, 20, 20); }\n"
+               "}\n"
+               "Button.Button1 {\n"
+               "    Text = \"Click me\";\n"
+               "}\n";
+    }
+
+    SECTION("Thread count")
+    {
+        tgui::FormLoader loader{3};
+        REQUIRE(loader.getThreadCount() == 3);
+
+        tgui::FormLoader defaultLoader;
+        REQUIRE(defaultLoader.getThreadCount() >= 1);
+    }
+
+    SECTION("Loading widgets")
+    {
+        auto group = tgui::Group::create();
+        tgui::FormLoader loader;
+
+        REQUIRE(!loader.isLoaded("FormLoaderFile.txt"));
+        loader.loadFileAsync("FormLoaderFile.txt");
+        loader.loadFileAsync("FormLoaderFile.txt");
+        REQUIRE_NOTHROW(loader.loadWidgets(*group, "FormLoaderFile.txt"));
+
+        REQUIRE(group->getWidgets().size() == 3);
+        REQUIRE(group->get<tgui::Picture>("Pic1") != nullptr);
+        REQUIRE(group->get<tgui::Picture>("Pic1")->getRenderer()->getTexture().getId() == "resources/image.png");
+        REQUIRE(group->get<tgui::Picture>("Pic2")->getRenderer()->getTexture().getImageSize() == tgui::Vector2f(20, 20));
+        REQUIRE(group->get<tgui::Button>("Button1")->getText() == "Click me");
+
+        // The prepared data is released once the widgets have been loaded
+        REQUIRE(!loader.isLoaded("FormLoaderFile.txt"));
+    }
+
+    SECTION("Images are decoded by the worker threads")
+    {
+        const auto oldImageLoader = tgui::Texture::getImageLoader();
+
+        std::atomic<unsigned int> imagesLoaded{0};
+        tgui::Texture::setImageLoader([&](const sf::String& filename){
+                ++imagesLoaded;
+                return oldImageLoader(filename);
+            });
+
+        {
+            tgui::FormLoader loader{2};
+            loader.loadFileAsync("FormLoaderFile.txt");
+
+            auto group = tgui::Group::create();
+            loader.loadWidgets(*group, "FormLoaderFile.txt");
+            REQUIRE(group->getWidgets().size() == 3);
+
+            // The image is only decoded once for both part rectangles, the texture manager doesn't need to load it again
+            REQUIRE(imagesLoaded == 1);
+        }
+
+        tgui::Texture::setImageLoader(oldImageLoader);
+    }
+
+    SECTION("Loading without calling loadFileAsync")
+    {
+        auto group = tgui::Group::create();
+        tgui::FormLoader loader{1};
+        loader.loadWidgets(*group, "FormLoaderFile.txt");
+        REQUIRE(group->getWidgets().size() == 3);
+    }
+
+    SECTION("Errors")
+    {
+        auto group = tgui::Group::create();
+        tgui::FormLoader loader;
+
+        loader.loadFileAsync("NonExistentFormLoaderFile.txt");
+        REQUIRE_THROWS_AS(loader.loadWidgets(*group, "NonExistentFormLoaderFile.txt"), tgui::Exception);
+
+        {
+            std::ofstream out{"FormLoaderInvalidFile.txt"};
+            out << "Button.Button1 {\n";
+        }
+        REQUIRE_THROWS_AS(loader.loadWidgets(*group, "FormLoaderInvalidFile.txt"), tgui::Exception);
+    }
+}
@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/MemoryPool.hpp>
+#include <TGUI/Layout.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <map>
+
+TEST_CASE("[MemoryPool]")
+{
+    SECTION("Blocks are reused")
+    {
+        void* ptr1 = tgui::MemoryPool::allocate(100);
+        REQUIRE(ptr1 != nullptr);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(ptr1) % alignof(std::max_align_t) == 0);
+
+        const std::size_t usedBytes = tgui::MemoryPool::getUsedBytes();
+        REQUIRE(usedBytes >= 100);
+        REQUIRE(tgui::MemoryPool::getReservedBytes() >= usedBytes);
+
+        tgui::MemoryPool::deallocate(ptr1, 100);
+        REQUIRE(tgui::MemoryPool::getUsedBytes() < usedBytes);
+
+        // Allocations with a similar size share the same blocks
+        void* ptr2 = tgui::MemoryPool::allocate(110);
+        REQUIRE(ptr2 == ptr1);
+        tgui::MemoryPool::deallocate(ptr2, 110);
+    }
+
+    SECTION("Large allocations")
+    {
+        const std::size_t reservedBytes = tgui::MemoryPool::getReservedBytes();
+        const std::size_t usedBytes = tgui::MemoryPool::getUsedBytes();
+
+        void* ptr = tgui::MemoryPool::allocate(tgui::MemoryPool::MaxBlockSize + 1);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(tgui::MemoryPool::getReservedBytes() == reservedBytes);
+        REQUIRE(tgui::MemoryPool::getUsedBytes() == usedBytes);
+        tgui::MemoryPool::deallocate(ptr, tgui::MemoryPool::MaxBlockSize + 1);
+    }
+
+    SECTION("PoolAllocator")
+    {
+        REQUIRE(tgui::MemoryPool::isEnabled());
+        tgui::PoolAllocator<int> poolAllocator;
+        REQUIRE(poolAllocator.isUsingPool());
+
+        tgui::MemoryPool::setEnabled(false);
+        REQUIRE(!tgui::MemoryPool::isEnabled());
+        tgui::PoolAllocator<int> defaultAllocator;
+        REQUIRE(!defaultAllocator.isUsingPool());
+        tgui::MemoryPool::setEnabled(true);
+
+        REQUIRE(poolAllocator != defaultAllocator);
+        REQUIRE(poolAllocator == tgui::PoolAllocator<char>{poolAllocator});
+
+        const std::size_t usedBytes = tgui::MemoryPool::getUsedBytes();
+        {
+            std::map<int, int, std::less<int>, tgui::PoolAllocator<std::pair<const int, int>>> map;
+            for (int i = 0; i < 100; ++i)
+                map[i] = i * 2;
+
+            REQUIRE(map[50] == 100);
+            REQUIRE(tgui::MemoryPool::getUsedBytes() > usedBytes);
+
+            // The allocator is propagated on assignment, so the memory is still released to the place it came from
+            std::map<int, int, std::less<int>, tgui::PoolAllocator<std::pair<const int, int>>> otherMap{defaultAllocator};
+            otherMap = map;
+            REQUIRE(otherMap.size() == 100);
+        }
+        REQUIRE(tgui::MemoryPool::getUsedBytes() == usedBytes);
+    }
+
+    SECTION("Widgets")
+    {
+        const std::size_t usedBytes = tgui::MemoryPool::getUsedBytes();
+        {
+            auto button = tgui::Button::create("Pooled");
+            button->setSize({"50%", "parent.height - 10"});
+            button->connect("Pressed", []{});
+            REQUIRE(tgui::MemoryPool::getUsedBytes() > usedBytes);
+
+            auto copy = tgui::Button::copy(button);
+            REQUIRE(copy->getText() == "Pooled");
+        }
+        REQUIRE(tgui::MemoryPool::getUsedBytes() == usedBytes);
+
+        tgui::MemoryPool::setEnabled(false);
+        {
+            auto button = tgui::Button::create("Not pooled");
+            REQUIRE(tgui::MemoryPool::getUsedBytes() == usedBytes);
+        }
+        tgui::MemoryPool::setEnabled(true);
+    }
+
+    SECTION("Layouts")
+    {
+        const std::size_t usedBytes = tgui::MemoryPool::getUsedBytes();
+
+        tgui::MemoryPool::setEnabled(false);
+        auto layout = std::make_unique<tgui::Layout>(tgui::Layout{"50%"} - 10);
+        REQUIRE(tgui::MemoryPool::getUsedBytes() == usedBytes);
+
+        // The operands are released to the place they came from, even when the pool was enabled in the meantime
+        tgui::MemoryPool::setEnabled(true);
+        layout = nullptr;
+        REQUIRE(tgui::MemoryPool::getUsedBytes() == usedBytes);
+
+        layout = std::make_unique<tgui::Layout>(tgui::Layout{"50%"} - 10);
+        REQUIRE(tgui::MemoryPool::getUsedBytes() > usedBytes);
+        tgui::MemoryPool::setEnabled(false);
+        layout = nullptr;
+        REQUIRE(tgui::MemoryPool::getUsedBytes() == usedBytes);
+        tgui::MemoryPool::setEnabled(true);
+    }
+}
@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/MemoryUsage.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[MemoryUsage]")
+{
+    SECTION("Widgets")
+    {
+        auto panel = tgui::Panel::create();
+        tgui::MemoryUsage emptyUsage;
+        emptyUsage.addWidget(*panel);
+        REQUIRE(emptyUsage.getWidgetBytes() > 0);
+        REQUIRE(emptyUsage.getRendererDataBytes() > 0);
+
+        auto label = tgui::Label::create("Some text");
+        panel->add(label);
+        tgui::MemoryUsage usage;
+        usage.addWidget(*panel);
+        REQUIRE(usage.getWidgetBytes() > emptyUsage.getWidgetBytes());
+        REQUIRE(usage.getFontBytes() > 0);
+
+        // Widgets are only counted once
+        const std::size_t widgetBytes = usage.getWidgetBytes();
+        usage.addWidget(*label);
+        REQUIRE(usage.getWidgetBytes() == widgetBytes);
+
+        label->setText("Some text that is a lot longer than the previous one");
+        tgui::MemoryUsage longerUsage;
+        longerUsage.addWidget(*panel);
+        REQUIRE(longerUsage.getWidgetBytes() > usage.getWidgetBytes());
+        REQUIRE(longerUsage.getTotalBytes() > usage.getTotalBytes());
+    }
+
+    SECTION("Shared renderers")
+    {
+        auto panel = tgui::Panel::create();
+        panel->add(tgui::Button::create());
+
+        tgui::MemoryUsage usage1;
+        usage1.addWidget(*panel);
+
+        panel->add(tgui::Button::create());
+        tgui::MemoryUsage usage2;
+        usage2.addWidget(*panel);
+
+        REQUIRE(usage2.getWidgetBytes() > usage1.getWidgetBytes());
+        REQUIRE(usage2.getRendererDataBytes() == usage1.getRendererDataBytes());
+    }
+
+    SECTION("Gui")
+    {
+        sf::RenderTexture target;
+        target.create(50, 50);
+        tgui::Gui gui{target};
+
+        tgui::MemoryUsage emptyUsage;
+        emptyUsage.addGui(gui);
+
+        gui.add(tgui::Button::create("Button"));
+        tgui::MemoryUsage usage;
+        usage.addGui(gui);
+        REQUIRE(usage.getWidgetBytes() > emptyUsage.getWidgetBytes());
+        REQUIRE(usage.getFontBytes() > 0);
+    }
+
+    SECTION("Textures")
+    {
+        const tgui::MemoryUsage usageBefore;
+
+        // The part of the image is only used here, so the texture manager has to create a new texture for it
+        tgui::Texture texture{"resources/image.png", {1, 2, 13, 17}};
+        const tgui::MemoryUsage usageAfter;
+        REQUIRE(usageAfter.getTextureImageBytes() == usageBefore.getTextureImageBytes() + 50 * 50 * 4);
+        REQUIRE(usageAfter.getTextureGpuBytes() == usageBefore.getTextureGpuBytes() + 13 * 17 * 4);
+    }
+
+    SECTION("Theme")
+    {
+        tgui::Theme theme{"resources/ThemeButton1.txt"};
+        theme.getRenderer("Button1");
+
+        tgui::MemoryUsage usage;
+        REQUIRE(usage.getThemeCacheBytes() > 0);
+
+        const std::size_t rendererBytes = usage.getRendererDataBytes();
+        usage.addTheme(theme);
+        REQUIRE(usage.getRendererDataBytes() > rendererBytes);
+    }
+
+    SECTION("Allocations")
+    {
+        tgui::MemoryUsage::endFrame();
+
+        tgui::MemoryUsage::recordAllocation(10);
+        tgui::MemoryUsage::recordAllocation(20);
+        tgui::MemoryUsage::recordDeallocation(10);
+
+        // Other allocations are only counted when the application defines the hooks, which the tests don't do
+        auto stats = tgui::MemoryUsage::getCurrentFrameAllocations();
+        REQUIRE(stats.allocations == 2);
+        REQUIRE(stats.deallocations == 1);
+        REQUIRE(stats.bytesAllocated == 30);
+        REQUIRE(stats.bytesFreed == 10);
+
+        tgui::MemoryUsage::endFrame();
+        stats = tgui::MemoryUsage::getLastFrameAllocations();
+        REQUIRE(stats.allocations == 2);
+        REQUIRE(stats.bytesAllocated == 30);
+        REQUIRE(tgui::MemoryUsage::getCurrentFrameAllocations().allocations == 0);
+    }
+}
@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <fstream>
+
+TEST_CASE("[Profiler]")
+{
+    tgui::Profiler::clear();
+
+    SECTION("Enabled")
+    {
+        REQUIRE(!tgui::Profiler::isEnabled());
+        tgui::Profiler::setEnabled(true);
+        REQUIRE(tgui::Profiler::isEnabled());
+        tgui::Profiler::setEnabled(false);
+        REQUIRE(!tgui::Profiler::isEnabled());
+    }
+
+    SECTION("MaxRecordedFrames")
+    {
+        REQUIRE(tgui::Profiler::getMaxRecordedFrames() == 120);
+        tgui::Profiler::setMaxRecordedFrames(2);
+        REQUIRE(tgui::Profiler::getMaxRecordedFrames() == 2);
+    }
+
+    SECTION("Recording")
+    {
+        sf::RenderTexture target;
+        target.create(200, 100);
+        tgui::Gui gui{target};
+
+        auto panel = tgui::Panel::create({150, 80});
+        gui.add(panel);
+
+        auto button = tgui::Button::create("Button");
+        panel->add(button);
+
+        // Nothing is recorded while the profiler is disabled
+        gui.draw();
+        REQUIRE(tgui::Profiler::getRecordedFrames().empty());
+
+        tgui::Profiler::setEnabled(true);
+        tgui::Profiler::setMaxRecordedFrames(2);
+        gui.draw();
+        gui.draw();
+        gui.draw();
+        tgui::Profiler::setEnabled(false);
+
+        if (tgui::Profiler::isAvailable())
+        {
+            const auto frames = tgui::Profiler::getRecordedFrames();
+            REQUIRE(frames.size() == 2);
+            REQUIRE(frames[0].frameNumber == 1);
+            REQUIRE(frames[1].frameNumber == 2);
+
+            const auto frame = tgui::Profiler::getLastFrame();
+            REQUIRE(frame.frameNumber == 2);
+            REQUIRE(frame.drawCalls > 0);
+            REQUIRE(frame.clippings > 0);
+            REQUIRE(frame.widgets.size() == 2);
+            REQUIRE(frame.widgets.at(panel.get()).type == "Panel");
+            REQUIRE(frame.widgets.at(panel.get()).calls == 1);
+            REQUIRE(frame.widgets.at(button.get()).type == "Button");
+            REQUIRE(frame.widgetTypes.count("Panel") == 1);
+            REQUIRE(frame.widgetTypes.count("Button") == 1);
+
+            tgui::Profiler::saveChromeTrace("ProfilerTrace.json");
+            std::ifstream file{"ProfilerTrace.json"};
+            const std::string contents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+            REQUIRE(contents.find("\"traceEvents\"") != std::string::npos);
+            REQUIRE(contents.find("\"name\": \"Gui::draw\"") != std::string::npos);
+            REQUIRE(contents.find("\"name\": \"Button\"") != std::string::npos);
+        }
+        else
+            REQUIRE(tgui::Profiler::getRecordedFrames().empty());
+
+        tgui::Profiler::clear();
+        REQUIRE(tgui::Profiler::getRecordedFrames().empty());
+    }
+
+    SECTION("Glyph misses")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        font.preloadGlyphs("Preloaded", 71);
+        font.preloadGlyphs("g", 71); // Used by Text to calculate its height
+
+        tgui::Text text;
+        text.setFont(font);
+        text.setCharacterSize(71);
+
+        tgui::Profiler::setEnabled(true);
+        text.setString("Preloaded");
+        tgui::Profiler::endFrame();
+        text.setString("New text");
+        tgui::Profiler::endFrame();
+        tgui::Profiler::setEnabled(false);
+
+        if (tgui::Profiler::isAvailable())
+        {
+            const auto frames = tgui::Profiler::getRecordedFrames();
+            REQUIRE(frames.size() == 2);
+            REQUIRE(frames[0].glyphMisses == 0);
+            REQUIRE(frames[1].glyphMisses > 0);
+        }
+    }
+
+    tgui::Profiler::setEnabled(false);
+    tgui::Profiler::setMaxRecordedFrames(120);
+    tgui::Profiler::clear();
+}
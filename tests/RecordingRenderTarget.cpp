@@ -0,0 +1,166 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/RecordingRenderTarget.hpp>
+#include <TGUI/DrawOpacity.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[RecordingRenderTarget]")
+{
+    tgui::RecordingRenderTarget target{{200, 100}};
+    REQUIRE(target.getSize() == sf::Vector2u(200, 100));
+    REQUIRE(target.getCommands().empty());
+
+    tgui::Gui gui{target};
+
+    auto panel = tgui::Panel::create({100, 50});
+    panel->setPosition(10, 20);
+    panel->getRenderer()->setBackgroundColor(sf::Color::Red);
+    gui.add(panel);
+
+    auto button = tgui::Button::create("Button");
+    button->setPosition(5, 5);
+    panel->add(button);
+
+    SECTION("Recording")
+    {
+        // Drawing directly on the target doesn't do anything
+        target.clear();
+        target.draw(sf::RectangleShape{{10, 10}});
+        REQUIRE(target.getCommands().empty());
+
+        gui.draw();
+        const auto& commands = target.getCommands();
+        REQUIRE(!commands.empty());
+
+        // The background of the panel is drawn over the entire target
+        REQUIRE(commands[0].type == tgui::RecordingRenderTarget::DrawCommand::Type::Shape);
+        REQUIRE(commands[0].clipRect == sf::IntRect(0, 0, 200, 100));
+        REQUIRE(commands[0].vertices.size() == 4);
+        REQUIRE(commands[0].vertices[0].color == sf::Color::Red);
+        REQUIRE(commands[0].transform.transformPoint(commands[0].vertices[2].position) == sf::Vector2f(110, 70));
+
+        // The button is clipped to the panel
+        REQUIRE(commands.size() > 1);
+        for (std::size_t i = 1; i < commands.size(); ++i)
+            REQUIRE(commands[i].clipRect == sf::IntRect(10, 20, 100, 50));
+
+        bool textFound = false;
+        for (const auto& command : commands)
+        {
+            if ((command.type == tgui::RecordingRenderTarget::DrawCommand::Type::Text) && (command.string == "Button"))
+                textFound = true;
+        }
+        REQUIRE(textFound);
+
+        target.clearCommands();
+        REQUIRE(target.getCommands().empty());
+    }
+
+    SECTION("Opacity of container")
+    {
+        panel->getRenderer()->setOpacity(0.5f);
+        REQUIRE(button->getInheritedOpacity() == 0.5f);
+
+        gui.draw();
+        const auto& commands = target.getCommands();
+        REQUIRE(commands.size() > 1);
+
+        // The panel itself bakes its opacity in its colors, its children are faded while being drawn
+        REQUIRE(commands[0].vertices[0].color == sf::Color(255, 0, 0, 127));
+        for (std::size_t i = 1; i < commands.size(); ++i)
+        {
+            for (const auto& vertex : commands[i].vertices)
+                REQUIRE(vertex.color.a <= 128);
+        }
+
+        // The opacity is restored after drawing
+        REQUIRE(tgui::priv::getDrawOpacity() == 1);
+
+        // Texts are faded while being drawn, but keep their own color afterwards
+        const auto findTextColor = [&]{
+                for (const auto& command : target.getCommands())
+                {
+                    if (command.type == tgui::RecordingRenderTarget::DrawCommand::Type::Text)
+                        return command.color;
+                }
+                return sf::Color::Transparent;
+            };
+        REQUIRE(findTextColor().a <= 128);
+        panel->getRenderer()->setOpacity(1);
+        target.clearCommands();
+        gui.draw();
+        REQUIRE(findTextColor().a == 255);
+
+        panel->getRenderer()->setOpacity(0);
+        target.clearCommands();
+        gui.draw();
+        REQUIRE(target.getCommands().size() == 1);
+    }
+
+    SECTION("Opacity of shape with outline")
+    {
+        sf::RectangleShape shape{{10, 10}};
+        shape.setFillColor(sf::Color::Red);
+        shape.setOutlineColor(sf::Color::Blue);
+        shape.setOutlineThickness(2);
+        shape.setPosition(5, 5);
+
+        tgui::priv::setDrawOpacity(0.5f);
+        tgui::priv::drawShape(target, shape, {});
+        tgui::priv::setDrawOpacity(1);
+
+        const auto& commands = target.getCommands();
+        REQUIRE(commands.size() == 1);
+        REQUIRE(commands[0].type == tgui::RecordingRenderTarget::DrawCommand::Type::Shape);
+        REQUIRE(commands[0].vertices.size() == 4);
+        REQUIRE(commands[0].vertices[0].color == sf::Color(255, 0, 0, 127));
+        REQUIRE(commands[0].outlineColor == sf::Color(0, 0, 255, 127));
+        REQUIRE(commands[0].outlineThickness == 2);
+        REQUIRE(commands[0].transform.transformPoint({0, 0}) == sf::Vector2f(5, 5));
+
+        // The shape itself isn't changed
+        REQUIRE(shape.getFillColor() == sf::Color::Red);
+        REQUIRE(shape.getOutlineColor() == sf::Color::Blue);
+    }
+
+    SECTION("toString")
+    {
+        gui.draw();
+        const std::string firstDraw = target.toString();
+        REQUIRE(firstDraw.find("Shape clip=0,0,200,100") == 0);
+        REQUIRE(firstDraw.find("text=\"Button\"") != std::string::npos);
+
+        target.clearCommands();
+        gui.draw();
+        REQUIRE(target.toString() == firstDraw);
+
+        button->setText("Changed");
+        target.clearCommands();
+        gui.draw();
+        REQUIRE(target.toString() != firstDraw);
+    }
+}
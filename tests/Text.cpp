@@ -73,6 +73,33 @@ TEST_CASE("[Text]")
         REQUIRE(text.getStyle() == sf::Text::Italic);
     }
 
+    SECTION("Copies are independent")
+    {
+        text.setFont("resources/DejaVuSans.ttf");
+        text.setString("Original");
+        text.setCharacterSize(20);
+
+        tgui::Text copy = text;
+        REQUIRE(copy.getString() == "Original");
+        REQUIRE(copy.getSize() == text.getSize());
+
+        copy.setString("Changed copy");
+        copy.setCharacterSize(30);
+        copy.setStyle(sf::Text::Bold);
+        REQUIRE(copy.getString() == "Changed copy");
+        REQUIRE(copy.getCharacterSize() == 30);
+        REQUIRE(copy.getStyle() == sf::Text::Bold);
+
+        REQUIRE(text.getString() == "Original");
+        REQUIRE(text.getCharacterSize() == 20);
+        REQUIRE(text.getStyle() == sf::Text::Regular);
+        REQUIRE(text.findCharacterPos(8).x < copy.findCharacterPos(8).x);
+
+        text.setFont(nullptr);
+        REQUIRE(text.getString() == "Original");
+        REQUIRE(copy.getFont() != nullptr);
+    }
+
     SECTION("Size")
     {
         text.setFont("resources/DejaVuSans.ttf");
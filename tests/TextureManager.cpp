@@ -24,9 +24,12 @@
 
 #include "Tests.hpp"
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Picture.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
 #include <SFML/System/Err.hpp>
+#include <thread>
 
 TEST_CASE("[TextureManager]")
 {
@@ -52,4 +55,149 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+    SECTION("Alpha mask")
+    {
+        REQUIRE(!tgui::TextureManager::isAlphaMaskEnabled());
+        tgui::Texture fullTexture{"resources/TransparentParts.png"};
+        REQUIRE(fullTexture.getData()->image != nullptr);
+        REQUIRE(fullTexture.getData()->alphaMask.empty());
+
+        tgui::TextureManager::setAlphaMaskEnabled(true);
+        REQUIRE(tgui::TextureManager::isAlphaMaskEnabled());
+
+        tgui::Texture partTexture{"resources/TransparentParts.png", {5, 5, 40, 35}};
+        REQUIRE(partTexture.getData()->image == nullptr);
+        REQUIRE(partTexture.getData()->alphaMask.size() == (40 * 35 + 31) / 32);
+
+        unsigned int transparentPixels = 0;
+        for (unsigned int y = 0; y < 35; ++y)
+        {
+            for (unsigned int x = 0; x < 40; ++x)
+            {
+                REQUIRE(partTexture.isTransparentPixel({x, y}) == fullTexture.isTransparentPixel({x + 5, y + 5}));
+                if (partTexture.isTransparentPixel({x, y}))
+                    transparentPixels++;
+            }
+        }
+        REQUIRE(transparentPixels > 0);
+
+        tgui::TextureManager::setAlphaMaskEnabled(false);
+    }
+
+    SECTION("Async loading")
+    {
+        REQUIRE(!tgui::TextureManager::isAsyncLoadingEnabled());
+        tgui::TextureManager::setAsyncLoadingEnabled(true);
+        REQUIRE(tgui::TextureManager::isAsyncLoadingEnabled());
+
+        SECTION("Upload budget")
+        {
+            REQUIRE(tgui::TextureManager::getUploadBudget() == 4 * 1024 * 1024);
+            tgui::TextureManager::setUploadBudget(40 * 4 * 10);
+            REQUIRE(tgui::TextureManager::getUploadBudget() == 40 * 4 * 10);
+
+            tgui::Texture partTexture{"resources/TransparentParts.png", {5, 5, 40, 35}};
+            const auto data = partTexture.getData();
+            REQUIRE(data->loading);
+            REQUIRE(partTexture.getImageSize() == tgui::Vector2f(0, 0));
+            REQUIRE(tgui::TextureManager::getPendingAsyncLoadCount() == 1);
+
+            // Wait for the image to be decoded, which has happened when the first rows get uploaded
+            while (data->texture.getSize().x == 0)
+            {
+                tgui::TextureManager::uploadDecodedImages();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            // The budget allows 10 rows to be uploaded at once, so the remaining 25 rows take 3 more calls
+            unsigned int uploadCalls = 1;
+            while (data->loading)
+            {
+                tgui::TextureManager::uploadDecodedImages();
+                uploadCalls++;
+            }
+            REQUIRE(uploadCalls == 4);
+            REQUIRE(tgui::TextureManager::getPendingAsyncLoadCount() == 0);
+
+            REQUIRE(partTexture.getImageSize() == tgui::Vector2f(40, 35));
+            REQUIRE(partTexture.getMiddleRect() == sf::IntRect(0, 0, 40, 35));
+
+            tgui::TextureManager::setAsyncLoadingEnabled(false);
+            tgui::Texture fullTexture{"resources/TransparentParts.png"};
+            const sf::Image partImage = partTexture.getData()->texture.copyToImage();
+            const sf::Image fullImage = fullTexture.getData()->texture.copyToImage();
+            for (unsigned int y = 0; y < 35; ++y)
+            {
+                for (unsigned int x = 0; x < 40; ++x)
+                    REQUIRE(partImage.getPixel(x, y) == fullImage.getPixel(x + 5, y + 5));
+            }
+
+            tgui::TextureManager::setUploadBudget(4 * 1024 * 1024);
+        }
+
+        SECTION("Finish loading")
+        {
+            sf::RenderTexture target;
+            target.create(50, 50);
+            tgui::Gui gui{target};
+            gui.draw();
+
+            const std::size_t finishedCount = tgui::TextureManager::getFinishedAsyncLoadCount();
+            tgui::Texture imageTexture{"resources/image.png"};
+            tgui::Texture otherTexture{"resources/Texture1.png"};
+            REQUIRE(imageTexture.getData()->loading);
+            REQUIRE(otherTexture.getData()->loading);
+            REQUIRE(gui.isRedrawNeeded());
+
+            tgui::TextureManager::finishAsyncLoading();
+            REQUIRE(tgui::TextureManager::getFinishedAsyncLoadCount() == finishedCount + 2);
+
+            // The gui didn't upload the textures itself, but it still has to redraw the widgets that show them
+            REQUIRE(gui.isRedrawNeeded());
+            gui.draw();
+            REQUIRE(!gui.isRedrawNeeded());
+
+            REQUIRE(!imageTexture.getData()->loading);
+            REQUIRE(!otherTexture.getData()->loading);
+            REQUIRE(imageTexture.getImageSize() == tgui::Vector2f(50, 50));
+            REQUIRE(imageTexture.getData()->image != nullptr);
+        }
+
+        SECTION("Failed loading")
+        {
+            std::streambuf *oldErrBuf = sf::err().rdbuf(0);
+            tgui::Texture failedTexture;
+            REQUIRE_NOTHROW(failedTexture.load("NonExistent.png"));
+            REQUIRE(failedTexture.getData()->loading);
+
+            tgui::TextureManager::finishAsyncLoading();
+            REQUIRE(!failedTexture.getData()->loading);
+            REQUIRE(failedTexture.getImageSize() == tgui::Vector2f(0, 0));
+            sf::err().rdbuf(oldErrBuf);
+        }
+
+        SECTION("Widgets get the image size once loaded")
+        {
+            auto picture = tgui::Picture::create("resources/image.png");
+            REQUIRE(picture->getRenderer()->getTexture().isLoading());
+            REQUIRE(picture->getSize() == tgui::Vector2f(0, 0));
+
+            auto copiedPicture = tgui::Picture::copy(picture);
+            auto resizedPicture = tgui::Picture::create("resources/image.png");
+            resizedPicture->setSize(20, 30);
+
+            // Widgets that are destroyed before the texture is loaded are no longer notified
+            auto destroyedPicture = tgui::Picture::create("resources/image.png");
+            destroyedPicture = nullptr;
+
+            tgui::TextureManager::finishAsyncLoading();
+            REQUIRE(!picture->getRenderer()->getTexture().isLoading());
+            REQUIRE(picture->getSize() == tgui::Vector2f(50, 50));
+            REQUIRE(copiedPicture->getSize() == tgui::Vector2f(50, 50));
+            REQUIRE(resizedPicture->getSize() == tgui::Vector2f(20, 30));
+        }
+
+        tgui::TextureManager::setAsyncLoadingEnabled(false);
+    }
 }
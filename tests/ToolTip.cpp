@@ -73,6 +73,82 @@ TEST_CASE("[ToolTip]")
         REQUIRE(widget->getToolTip() == nullptr);
     }
 
+    SECTION("Showing tool tip")
+    {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        auto panel = tgui::Panel::create({100, 100});
+        auto widget = tgui::ClickableWidget::create({50, 50});
+        panel->add(widget);
+        gui.add(panel);
+
+        auto panelToolTip = tgui::Label::create("panel");
+        auto widgetToolTip = tgui::Label::create("widget");
+        panel->setToolTip(panelToolTip);
+        widget->setToolTip(widgetToolTip);
+
+        auto moveMouse = [&](int x, int y){
+            sf::Event event;
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = x;
+            event.mouseMove.y = y;
+            gui.handleEvent(event);
+        };
+
+        tgui::ToolTip::setTimeToDisplay(sf::milliseconds(300));
+
+        // The tool tip of the innermost widget is shown after the mouse stood still long enough
+        moveMouse(20, 20);
+        gui.updateTime(sf::milliseconds(200));
+        REQUIRE(gui.getVisibleToolTip() == nullptr);
+        gui.updateTime(sf::milliseconds(100));
+        REQUIRE(gui.getVisibleToolTip() == widgetToolTip);
+
+        // The tool tip is drawn on top of the widgets without being added to the gui
+        REQUIRE(gui.getWidgets().size() == 1);
+        REQUIRE(widgetToolTip->getParent() == nullptr);
+        gui.draw();
+
+        // Moving the mouse hides the tool tip
+        moveMouse(80, 80);
+        REQUIRE(gui.getVisibleToolTip() == nullptr);
+        REQUIRE(gui.isRedrawNeeded());
+        gui.updateTime(sf::milliseconds(300));
+        REQUIRE(gui.getVisibleToolTip() == panelToolTip);
+
+        // No tool tip is shown when the mouse isn't on a widget with a tool tip
+        moveMouse(150, 150);
+        gui.updateTime(sf::milliseconds(300));
+        REQUIRE(gui.getVisibleToolTip() == nullptr);
+
+        // Hidden widgets don't show their tool tip
+        moveMouse(20, 20);
+        widget->setVisible(false);
+        gui.updateTime(sf::milliseconds(300));
+        REQUIRE(gui.getVisibleToolTip() == panelToolTip);
+
+        // Widgets can decide themselves which tool tip to show
+        struct CustomToolTipWidget : public tgui::ClickableWidget
+        {
+            tgui::Widget::Ptr askToolTip(tgui::Vector2f mousePos) override
+            {
+                return mouseOnWidget(mousePos) ? customToolTip : nullptr;
+            }
+
+            tgui::Widget::Ptr customToolTip = tgui::Label::create("custom");
+        };
+
+        auto customWidget = std::make_shared<CustomToolTipWidget>();
+        customWidget->setPosition(110, 110);
+        customWidget->setSize(50, 50);
+        gui.add(customWidget);
+        moveMouse(130, 130);
+        gui.updateTime(sf::milliseconds(300));
+        REQUIRE(gui.getVisibleToolTip() == customWidget->customToolTip);
+    }
+
     tgui::ToolTip::setTimeToDisplay(oldTimeToDisplay);
     tgui::ToolTip::setDistanceToMouse(oldDistanceToMouse);
 }
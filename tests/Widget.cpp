@@ -26,6 +26,7 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
 
 TEST_CASE("[Widget]")
 {
@@ -280,6 +281,74 @@ TEST_CASE("[Widget]")
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
+    SECTION("Cached as bitmap")
+    {
+        REQUIRE(!widget->isCachedAsBitmap());
+        widget->setCachedAsBitmap(true);
+        REQUIRE(widget->isCachedAsBitmap());
+        REQUIRE(widget->clone()->isCachedAsBitmap());
+        widget->setCachedAsBitmap(false);
+        REQUIRE(!widget->isCachedAsBitmap());
+
+        auto panel = tgui::Panel::create({100, 80});
+        panel->setPosition(20, 10);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Yellow);
+        panel->getRenderer()->setBorders(2);
+        panel->getRenderer()->setBorderColor(sf::Color::Red);
+
+        auto child = tgui::Panel::create({50, 50});
+        child->setPosition(70, 40);
+        child->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        panel->add(child);
+
+        sf::RenderTexture target;
+        target.create(150, 120);
+        tgui::Gui gui{target};
+        gui.add(panel);
+
+        const auto drawToImage = [&]{
+                target.clear({25, 130, 10});
+                gui.draw();
+                target.display();
+                return target.getTexture().copyToImage();
+            };
+
+        const auto imagesEqual = [](const sf::Image& image1, const sf::Image& image2){
+                return (image1.getSize() == image2.getSize())
+                    && std::equal(image1.getPixelsPtr(), image1.getPixelsPtr() + image1.getSize().x * image1.getSize().y * 4, image2.getPixelsPtr());
+            };
+
+        const sf::Image uncachedImage = drawToImage();
+        panel->setCachedAsBitmap(true);
+        REQUIRE(imagesEqual(drawToImage(), uncachedImage));
+
+        // Moving the widget only changes where the bitmap is drawn
+        panel->setPosition(30, 20);
+        panel->setCachedAsBitmap(false);
+        const sf::Image movedImage = drawToImage();
+        panel->setCachedAsBitmap(true);
+        REQUIRE(imagesEqual(drawToImage(), movedImage));
+
+        // Changes to the renderer of a child are detected
+        child->getRenderer()->setBackgroundColor(sf::Color::Green);
+        const sf::Image cachedImage = drawToImage();
+        panel->setCachedAsBitmap(false);
+        REQUIRE(imagesEqual(cachedImage, drawToImage()));
+
+        // Changing the contents of a child is detected as well
+        auto progressBar = tgui::ProgressBar::create();
+        progressBar->setPosition(5, 5);
+        progressBar->setSize(60, 20);
+        panel->add(progressBar);
+        panel->setCachedAsBitmap(true);
+        drawToImage();
+        progressBar->setValue(50);
+        REQUIRE(gui.isRedrawNeeded());
+        const sf::Image cachedValueImage = drawToImage();
+        panel->setCachedAsBitmap(false);
+        REQUIRE(imagesEqual(cachedValueImage, drawToImage()));
+    }
+
     SECTION("Saving and loading widget from file")
     {
         auto parent = tgui::Panel::create();
@@ -26,6 +26,8 @@
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <TGUI/Widgets/Group.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/PopupLayer.hpp>
 
 TEST_CASE("[ComboBox]")
 {
@@ -329,6 +331,70 @@ TEST_CASE("[ComboBox]")
                 REQUIRE(itemSelectedCount == 3);
             }
         }
+
+        SECTION("List in popup layer of gui")
+        {
+            sf::RenderTexture target;
+            target.create(400, 300);
+            tgui::Gui gui{target};
+            gui.add(comboBox);
+
+            comboBox->setPosition(25, 6);
+            comboBox->setSize(150, 24);
+            comboBox->getRenderer()->setBorders(2);
+            comboBox->addItem("1");
+            comboBox->addItem("2");
+            comboBox->addItem("3");
+
+            // A widget that was added after the combo box lies below the open list
+            auto button = tgui::Button::create();
+            button->setPosition(25, 30);
+            button->setSize(150, 100);
+            gui.add(button);
+
+            unsigned int buttonPressedCount = 0;
+            button->connect("Pressed", &genericCallback, std::ref(buttonPressedCount));
+
+            auto mouseClick = [&gui](int x, int y) {
+                sf::Event event;
+                event.type = sf::Event::MouseMoved;
+                event.mouseMove.x = x;
+                event.mouseMove.y = y;
+                gui.handleEvent(event);
+
+                event.type = sf::Event::MouseButtonPressed;
+                event.mouseButton.button = sf::Mouse::Left;
+                event.mouseButton.x = x;
+                event.mouseButton.y = y;
+                gui.handleEvent(event);
+
+                event.type = sf::Event::MouseButtonReleased;
+                gui.handleEvent(event);
+            };
+
+            const auto& popupLayer = gui.getContainer()->getPopupLayer();
+
+            // Opening the list doesn't change the widgets in the gui
+            mouseClick(100, 15);
+            REQUIRE(gui.getWidgets().size() == 2);
+            REQUIRE(popupLayer->getWidgets().size() == 1);
+
+            mouseClick(100, 60);
+            REQUIRE(comboBox->getSelectedItemIndex() == 1);
+            REQUIRE(buttonPressedCount == 0);
+            REQUIRE(popupLayer->getWidgets().empty());
+
+            // Once the list is closed, the widget below it can be clicked again
+            mouseClick(100, 60);
+            REQUIRE(comboBox->getSelectedItemIndex() == 1);
+            REQUIRE(buttonPressedCount == 1);
+
+            // The list is closed when the combo box is removed from the gui
+            mouseClick(100, 15);
+            REQUIRE(popupLayer->getWidgets().size() == 1);
+            gui.remove(comboBox);
+            REQUIRE(popupLayer->getWidgets().empty());
+        }
     }
 
     testWidgetRenderer(comboBox->getRenderer());
@@ -319,6 +319,39 @@ TEST_CASE("[EditBox]")
                 REQUIRE(editBox->getText() == "-.");
             }
         }
+
+        SECTION("Custom")
+        {
+            editBox->setInputValidator("[a-zA-Z\\u00CA ]+[0-9]{0,2}");
+            REQUIRE(editBox->getInputValidator() == "[a-zA-Z\\u00CA ]+[0-9]{0,2}");
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText(L"Some Ê Text45");
+            REQUIRE(editBox->getText() == L"Some Ê Text45");
+
+            editBox->setText("Text456");
+            REQUIRE(editBox->getText() == "");
+
+            SECTION("Adding characters")
+            {
+                editBox->setText("Text");
+                editBox->textEntered('4');
+                editBox->textEntered('5');
+                editBox->textEntered('6');
+                REQUIRE(editBox->getText() == "Text45");
+
+                editBox->setCaretPosition(0);
+                editBox->textEntered('1');
+                REQUIRE(editBox->getText() == "Text45");
+
+                editBox->textEntered(L'\u00CA');
+                REQUIRE(editBox->getText() == L"\u00CAText45");
+
+                editBox->setCaretPosition(6);
+                editBox->textEntered('x');
+                REQUIRE(editBox->getText() == L"\u00CAText45");
+            }
+        }
     }
 
     SECTION("Events / Signals")
@@ -400,6 +433,28 @@ TEST_CASE("[EditBox]")
             editBox->keyPressed(keyEvent);
             REQUIRE(count == 2);
         }
+
+        SECTION("Selecting text with the mouse")
+        {
+            editBox->setSize(300, 30);
+            editBox->setText("Some text");
+
+            // Clicking behind the text places the caret at the end
+            editBox->leftMousePressed({290, 15});
+            editBox->leftMouseReleased({290, 15});
+            REQUIRE(editBox->getCaretPosition() == 9);
+
+            // Clicking in front of the text places the caret at the beginning
+            editBox->mouseMoved({1, 15});
+            editBox->leftMousePressed({1, 15});
+            REQUIRE(editBox->getCaretPosition() == 0);
+
+            // Dragging the mouse selects the text
+            editBox->mouseMoved({290, 15});
+            REQUIRE(editBox->getCaretPosition() == 9);
+            REQUIRE(editBox->getSelectedText() == "Some text");
+            editBox->leftMouseReleased({290, 15});
+        }
     }
 
     testWidgetRenderer(editBox->getRenderer());
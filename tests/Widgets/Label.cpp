@@ -64,6 +64,23 @@ TEST_CASE("[Label]")
         REQUIRE(label->getText() == "");
         label->setText("SomeText");
         REQUIRE(label->getText() == "SomeText");
+
+        SECTION("Changing the amount of lines")
+        {
+            label->setText("1");
+            const tgui::Vector2f singleLineSize = label->getSize();
+
+            label->setText("1\n1\n1");
+            REQUIRE(label->getSize().x == singleLineSize.x);
+            REQUIRE(label->getSize().y > singleLineSize.y);
+
+            label->setText("1");
+            REQUIRE(label->getSize() == singleLineSize);
+
+            label->setTextSize(label->getTextSize() * 2);
+            REQUIRE(label->getSize().x > singleLineSize.x);
+            REQUIRE(label->getSize().y > singleLineSize.y);
+        }
     }
 
     SECTION("TextSize")
@@ -24,7 +24,9 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/MenuBar.hpp>
+#include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/PopupLayer.hpp>
 
 TEST_CASE("[MenuBar]")
 {
@@ -222,7 +224,67 @@ TEST_CASE("[MenuBar]")
             testWidgetSignals(menuBar);
         }
 
-        /// TODO
+        SECTION("MenuItemClicked")
+        {
+            sf::RenderTexture target;
+            target.create(300, 200);
+            tgui::Gui gui{target};
+            gui.add(menuBar);
+
+            menuBar->setSize(300, 20);
+            menuBar->addMenu("File");
+            menuBar->addMenuItem("Quit");
+
+            // A widget that was added after the menu bar lies below the open menu
+            auto button = tgui::Button::create();
+            button->setPosition(0, 25);
+            button->setSize(100, 100);
+            gui.add(button);
+
+            unsigned int buttonPressedCount = 0;
+            button->connect("Pressed", &genericCallback, std::ref(buttonPressedCount));
+
+            std::vector<sf::String> clickedMenuItem;
+            menuBar->connect("MenuItemClicked", [&](const std::vector<sf::String>& item){ clickedMenuItem = item; });
+
+            auto mouseClick = [&gui](int x, int y) {
+                sf::Event event;
+                event.type = sf::Event::MouseMoved;
+                event.mouseMove.x = x;
+                event.mouseMove.y = y;
+                gui.handleEvent(event);
+
+                event.type = sf::Event::MouseButtonPressed;
+                event.mouseButton.button = sf::Mouse::Left;
+                event.mouseButton.x = x;
+                event.mouseButton.y = y;
+                gui.handleEvent(event);
+
+                event.type = sf::Event::MouseButtonReleased;
+                gui.handleEvent(event);
+            };
+
+            const auto& popupLayer = gui.getContainer()->getPopupLayer();
+
+            // Opening the menu doesn't change the widgets in the gui
+            mouseClick(10, 10);
+            REQUIRE(gui.getWidgets().size() == 2);
+            REQUIRE(popupLayer->getWidgets().size() == 1);
+
+            mouseClick(10, 30);
+            REQUIRE(clickedMenuItem == std::vector<sf::String>{"File", "Quit"});
+            REQUIRE(buttonPressedCount == 0);
+            REQUIRE(popupLayer->getWidgets().empty());
+
+            // The popup is closed when the menu bar is removed while the menu is open
+            mouseClick(10, 10);
+            REQUIRE(popupLayer->getWidgets().size() == 1);
+            gui.remove(menuBar);
+            REQUIRE(popupLayer->getWidgets().empty());
+
+            mouseClick(10, 30);
+            REQUIRE(buttonPressedCount == 1);
+        }
     }
 
     testWidgetRenderer(menuBar->getRenderer());
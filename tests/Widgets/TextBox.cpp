@@ -25,6 +25,7 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
 
 TEST_CASE("[TextBox]")
 {
@@ -532,6 +533,101 @@ TEST_CASE("[TextBox]")
         }
     }
 
+    SECTION("Editing keeps the lines consistent")
+    {
+        textBox->setSize(200, 100);
+        textBox->setTextSize(16);
+
+        sf::String text;
+        for (unsigned int i = 0; i < 50; ++i)
+            text += "Paragraph " + tgui::to_string(i) + " with enough words to be split over several lines\n";
+
+        textBox->setText(text);
+        REQUIRE(textBox->getText() == text);
+
+        // Type in the middle of the text
+        textBox->setCaretPosition(1000);
+        textBox->textEntered('X');
+        textBox->textEntered('\n');
+        text.insert(1000, "X\n");
+        REQUIRE(textBox->getText() == text);
+        REQUIRE(textBox->getCaretPosition() == 1002);
+
+        // Remove characters across paragraphs
+        sf::Event::KeyEvent event;
+        event.control = false;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+        event.code    = sf::Keyboard::BackSpace;
+
+        textBox->setCaretPosition(2000);
+        for (unsigned int i = 0; i < 100; ++i)
+            textBox->keyPressed(event);
+        text.erase(1900, 100);
+        REQUIRE(textBox->getText() == text);
+        REQUIRE(textBox->getCaretPosition() == 1900);
+
+        textBox->addText("End");
+        text += "End";
+        REQUIRE(textBox->getText() == text);
+        REQUIRE(textBox->getCaretPosition() == text.getSize());
+
+        // The lines are the same as when the text would have been set at once
+        auto textBox2 = tgui::TextBox::copy(textBox);
+        textBox2->setText(text);
+        REQUIRE(textBox->getLinesCount() == textBox2->getLinesCount());
+    }
+
+    SECTION("Only visible lines are drawn")
+    {
+        tgui::RecordingRenderTarget target{{300, 200}};
+        tgui::Gui gui{target};
+        gui.add(textBox);
+
+        sf::String text;
+        for (unsigned int i = 0; i < 1000; ++i)
+            text += "Line " + tgui::to_string(i) + "\n";
+
+        textBox->setSize(300, 200);
+        textBox->setTextSize(16);
+        textBox->getRenderer()->setTextColor(sf::Color::Blue);
+        textBox->getRenderer()->setSelectedTextColor(sf::Color::Red);
+        textBox->setText(text);
+
+        auto findTextVertices = [&]() -> const std::vector<sf::Vertex>& {
+            target.clearCommands();
+            gui.draw();
+
+            for (const auto& command : target.getCommands())
+            {
+                if ((command.type == tgui::RecordingRenderTarget::DrawCommand::Type::Vertices) && (command.primitiveType == sf::PrimitiveType::Triangles))
+                    return command.vertices;
+            }
+
+            FAIL("No text vertices were drawn");
+            return target.getCommands().front().vertices;
+        };
+
+        // Only a few lines fit inside the text box, so only a few lines worth of characters are drawn
+        const auto& vertices = findTextVertices();
+        REQUIRE(!vertices.empty());
+        REQUIRE(vertices.size() <= 20 * 9 * 6);
+        for (const auto& vertex : vertices)
+            REQUIRE(vertex.color == sf::Color::Blue);
+
+        // Selected characters get another color
+        sf::Event::KeyEvent event;
+        event.control = true;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+        event.code    = sf::Keyboard::A;
+        textBox->keyPressed(event);
+        for (const auto& vertex : findTextVertices())
+            REQUIRE(vertex.color == sf::Color::Red);
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("ctrl+alt+A should not act as ctrl+A (https://github.com/texus/TGUI/issues/43)")